@@ -0,0 +1,105 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/app/CMakeLists.txt"
+  "/root/repo/bench/CMakeLists.txt"
+  "/root/repo/build/_deps/googletest-src/CMakeLists.txt"
+  "/root/repo/build/_deps/googletest-src/googlemock/CMakeLists.txt"
+  "/root/repo/build/_deps/googletest-src/googlemock/cmake/gmock.pc.in"
+  "/root/repo/build/_deps/googletest-src/googlemock/cmake/gmock_main.pc.in"
+  "/root/repo/build/_deps/googletest-src/googletest/CMakeLists.txt"
+  "/root/repo/build/_deps/googletest-src/googletest/cmake/Config.cmake.in"
+  "/root/repo/build/_deps/googletest-src/googletest/cmake/gtest.pc.in"
+  "/root/repo/build/_deps/googletest-src/googletest/cmake/gtest_main.pc.in"
+  "/root/repo/build/_deps/googletest-src/googletest/cmake/internal_utils.cmake"
+  "/root/repo/inc/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "app/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "build/_deps/googletest-src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "build/_deps/googletest-src/googletest/generated/gmock.pc"
+  "build/_deps/googletest-src/googletest/generated/gmock_main.pc"
+  "build/_deps/googletest-src/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "build/_deps/googletest-src/googletest/generated/GTestConfigVersion.cmake"
+  "build/_deps/googletest-src/googletest/generated/GTestConfig.cmake"
+  "build/_deps/googletest-src/googletest/generated/gtest.pc"
+  "build/_deps/googletest-src/googletest/generated/gtest_main.pc"
+  "build/_deps/googletest-src/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/CardLib.dir/DependInfo.cmake"
+  "src/CMakeFiles/blackjack_c.dir/DependInfo.cmake"
+  "app/CMakeFiles/blackjack.dir/DependInfo.cmake"
+  "app/CMakeFiles/hhtool.dir/DependInfo.cmake"
+  "app/CMakeFiles/bjserver.dir/DependInfo.cmake"
+  "app/CMakeFiles/bjload.dir/DependInfo.cmake"
+  "app/CMakeFiles/strategygen.dir/DependInfo.cmake"
+  "app/CMakeFiles/basic_strategy.dir/DependInfo.cmake"
+  "app/CMakeFiles/bjembed.dir/DependInfo.cmake"
+  "bench/CMakeFiles/allocbench.dir/DependInfo.cmake"
+  "bench/CMakeFiles/ruinbench.dir/DependInfo.cmake"
+  "bench/CMakeFiles/tournamentbench.dir/DependInfo.cmake"
+  "build/_deps/googletest-src/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "build/_deps/googletest-src/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "build/_deps/googletest-src/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "build/_deps/googletest-src/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "tests/CMakeFiles/blackjacktests.dir/DependInfo.cmake"
+  )
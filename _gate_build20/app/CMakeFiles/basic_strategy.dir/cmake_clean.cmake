@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basic_strategy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/basic_strategy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bjembed.dir/embed.c.o"
+  "CMakeFiles/bjembed.dir/embed.c.o.d"
+  "bjembed"
+  "bjembed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bjembed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bjload.dir/loadgen.cpp.o"
+  "CMakeFiles/bjload.dir/loadgen.cpp.o.d"
+  "bjload"
+  "bjload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bjload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bjserver.dir/server.cpp.o"
+  "CMakeFiles/bjserver.dir/server.cpp.o.d"
+  "bjserver"
+  "bjserver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bjserver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blackjack.dir/game.cpp.o"
+  "CMakeFiles/blackjack.dir/game.cpp.o.d"
+  "blackjack"
+  "blackjack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blackjack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
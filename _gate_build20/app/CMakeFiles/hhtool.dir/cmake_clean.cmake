@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hhtool.dir/hhtool.cpp.o"
+  "CMakeFiles/hhtool.dir/hhtool.cpp.o.d"
+  "hhtool"
+  "hhtool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hhtool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
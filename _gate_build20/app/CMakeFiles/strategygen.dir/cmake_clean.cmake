@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/strategygen.dir/strategygen.cpp.o"
+  "CMakeFiles/strategygen.dir/strategygen.cpp.o.d"
+  "strategygen"
+  "strategygen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/strategygen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ruinbench.dir/ruinbench.cpp.o"
+  "CMakeFiles/ruinbench.dir/ruinbench.cpp.o.d"
+  "ruinbench"
+  "ruinbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ruinbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
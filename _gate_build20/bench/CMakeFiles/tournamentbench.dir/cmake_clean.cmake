@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tournamentbench.dir/tournamentbench.cpp.o"
+  "CMakeFiles/tournamentbench.dir/tournamentbench.cpp.o.d"
+  "tournamentbench"
+  "tournamentbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tournamentbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
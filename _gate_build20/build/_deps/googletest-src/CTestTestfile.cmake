@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/build/_deps/googletest-src
+# Build directory: /root/repo/_gate_build20/build/_deps/googletest-src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("googlemock")
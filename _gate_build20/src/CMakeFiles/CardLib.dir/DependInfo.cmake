@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/BankrollSimulator.cpp" "src/CMakeFiles/CardLib.dir/BankrollSimulator.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/BankrollSimulator.cpp.o.d"
+  "/root/repo/src/Card.cpp" "src/CMakeFiles/CardLib.dir/Card.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Card.cpp.o.d"
+  "/root/repo/src/DealerTable.cpp" "src/CMakeFiles/CardLib.dir/DealerTable.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/DealerTable.cpp.o.d"
+  "/root/repo/src/Deck.cpp" "src/CMakeFiles/CardLib.dir/Deck.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Deck.cpp.o.d"
+  "/root/repo/src/GameServer.cpp" "src/CMakeFiles/CardLib.dir/GameServer.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/GameServer.cpp.o.d"
+  "/root/repo/src/HandHistory.cpp" "src/CMakeFiles/CardLib.dir/HandHistory.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/HandHistory.cpp.o.d"
+  "/root/repo/src/InfiniteDeck.cpp" "src/CMakeFiles/CardLib.dir/InfiniteDeck.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/InfiniteDeck.cpp.o.d"
+  "/root/repo/src/MonotonicArena.cpp" "src/CMakeFiles/CardLib.dir/MonotonicArena.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/MonotonicArena.cpp.o.d"
+  "/root/repo/src/MultiCounter.cpp" "src/CMakeFiles/CardLib.dir/MultiCounter.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/MultiCounter.cpp.o.d"
+  "/root/repo/src/Pipeline.cpp" "src/CMakeFiles/CardLib.dir/Pipeline.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Pipeline.cpp.o.d"
+  "/root/repo/src/Player.cpp" "src/CMakeFiles/CardLib.dir/Player.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Player.cpp.o.d"
+  "/root/repo/src/PlayerPool.cpp" "src/CMakeFiles/CardLib.dir/PlayerPool.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/PlayerPool.cpp.o.d"
+  "/root/repo/src/Round.cpp" "src/CMakeFiles/CardLib.dir/Round.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Round.cpp.o.d"
+  "/root/repo/src/RuinCalculator.cpp" "src/CMakeFiles/CardLib.dir/RuinCalculator.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/RuinCalculator.cpp.o.d"
+  "/root/repo/src/ShuffleKernel.cpp" "src/CMakeFiles/CardLib.dir/ShuffleKernel.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/ShuffleKernel.cpp.o.d"
+  "/root/repo/src/Statistics.cpp" "src/CMakeFiles/CardLib.dir/Statistics.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Statistics.cpp.o.d"
+  "/root/repo/src/StrategySolver.cpp" "src/CMakeFiles/CardLib.dir/StrategySolver.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/StrategySolver.cpp.o.d"
+  "/root/repo/src/StringInterner.cpp" "src/CMakeFiles/CardLib.dir/StringInterner.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/StringInterner.cpp.o.d"
+  "/root/repo/src/Table.cpp" "src/CMakeFiles/CardLib.dir/Table.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Table.cpp.o.d"
+  "/root/repo/src/TableScheduler.cpp" "src/CMakeFiles/CardLib.dir/TableScheduler.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/TableScheduler.cpp.o.d"
+  "/root/repo/src/ThresholdModel.cpp" "src/CMakeFiles/CardLib.dir/ThresholdModel.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/ThresholdModel.cpp.o.d"
+  "/root/repo/src/ThresholdSweep.cpp" "src/CMakeFiles/CardLib.dir/ThresholdSweep.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/ThresholdSweep.cpp.o.d"
+  "/root/repo/src/Tournament.cpp" "src/CMakeFiles/CardLib.dir/Tournament.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/Tournament.cpp.o.d"
+  "/root/repo/src/WhatIf.cpp" "src/CMakeFiles/CardLib.dir/WhatIf.cpp.o" "gcc" "src/CMakeFiles/CardLib.dir/WhatIf.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CardLib.dir/BankrollSimulator.cpp.o"
+  "CMakeFiles/CardLib.dir/BankrollSimulator.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Card.cpp.o"
+  "CMakeFiles/CardLib.dir/Card.cpp.o.d"
+  "CMakeFiles/CardLib.dir/DealerTable.cpp.o"
+  "CMakeFiles/CardLib.dir/DealerTable.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Deck.cpp.o"
+  "CMakeFiles/CardLib.dir/Deck.cpp.o.d"
+  "CMakeFiles/CardLib.dir/GameServer.cpp.o"
+  "CMakeFiles/CardLib.dir/GameServer.cpp.o.d"
+  "CMakeFiles/CardLib.dir/HandHistory.cpp.o"
+  "CMakeFiles/CardLib.dir/HandHistory.cpp.o.d"
+  "CMakeFiles/CardLib.dir/InfiniteDeck.cpp.o"
+  "CMakeFiles/CardLib.dir/InfiniteDeck.cpp.o.d"
+  "CMakeFiles/CardLib.dir/MonotonicArena.cpp.o"
+  "CMakeFiles/CardLib.dir/MonotonicArena.cpp.o.d"
+  "CMakeFiles/CardLib.dir/MultiCounter.cpp.o"
+  "CMakeFiles/CardLib.dir/MultiCounter.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Pipeline.cpp.o"
+  "CMakeFiles/CardLib.dir/Pipeline.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Player.cpp.o"
+  "CMakeFiles/CardLib.dir/Player.cpp.o.d"
+  "CMakeFiles/CardLib.dir/PlayerPool.cpp.o"
+  "CMakeFiles/CardLib.dir/PlayerPool.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Round.cpp.o"
+  "CMakeFiles/CardLib.dir/Round.cpp.o.d"
+  "CMakeFiles/CardLib.dir/RuinCalculator.cpp.o"
+  "CMakeFiles/CardLib.dir/RuinCalculator.cpp.o.d"
+  "CMakeFiles/CardLib.dir/ShuffleKernel.cpp.o"
+  "CMakeFiles/CardLib.dir/ShuffleKernel.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Statistics.cpp.o"
+  "CMakeFiles/CardLib.dir/Statistics.cpp.o.d"
+  "CMakeFiles/CardLib.dir/StrategySolver.cpp.o"
+  "CMakeFiles/CardLib.dir/StrategySolver.cpp.o.d"
+  "CMakeFiles/CardLib.dir/StringInterner.cpp.o"
+  "CMakeFiles/CardLib.dir/StringInterner.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Table.cpp.o"
+  "CMakeFiles/CardLib.dir/Table.cpp.o.d"
+  "CMakeFiles/CardLib.dir/TableScheduler.cpp.o"
+  "CMakeFiles/CardLib.dir/TableScheduler.cpp.o.d"
+  "CMakeFiles/CardLib.dir/ThresholdModel.cpp.o"
+  "CMakeFiles/CardLib.dir/ThresholdModel.cpp.o.d"
+  "CMakeFiles/CardLib.dir/ThresholdSweep.cpp.o"
+  "CMakeFiles/CardLib.dir/ThresholdSweep.cpp.o.d"
+  "CMakeFiles/CardLib.dir/Tournament.cpp.o"
+  "CMakeFiles/CardLib.dir/Tournament.cpp.o.d"
+  "CMakeFiles/CardLib.dir/WhatIf.cpp.o"
+  "CMakeFiles/CardLib.dir/WhatIf.cpp.o.d"
+  "libCardLib.a"
+  "libCardLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CardLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
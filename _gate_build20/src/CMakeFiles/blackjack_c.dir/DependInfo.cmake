@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/blackjack_c.cpp" "src/CMakeFiles/blackjack_c.dir/blackjack_c.cpp.o" "gcc" "src/CMakeFiles/blackjack_c.dir/blackjack_c.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build20/src/libblackjack_c.so" "/root/repo/_gate_build20/src/libblackjack_c.so.1.0.0"
+  "/root/repo/_gate_build20/src/libblackjack_c.so.1" "/root/repo/_gate_build20/src/libblackjack_c.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build20/src/CMakeFiles/CardLib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
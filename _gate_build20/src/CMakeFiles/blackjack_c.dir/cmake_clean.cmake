@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blackjack_c.dir/blackjack_c.cpp.o"
+  "CMakeFiles/blackjack_c.dir/blackjack_c.cpp.o.d"
+  "libblackjack_c.pdb"
+  "libblackjack_c.so"
+  "libblackjack_c.so.1"
+  "libblackjack_c.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blackjack_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
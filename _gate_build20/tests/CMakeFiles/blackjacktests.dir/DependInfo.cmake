@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/AllocationHooks.cpp" "tests/CMakeFiles/blackjacktests.dir/AllocationHooks.cpp.o" "gcc" "tests/CMakeFiles/blackjacktests.dir/AllocationHooks.cpp.o.d"
+  "/root/repo/tests/blackjacktests.cpp" "tests/CMakeFiles/blackjacktests.dir/blackjacktests.cpp.o" "gcc" "tests/CMakeFiles/blackjacktests.dir/blackjacktests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build20/build/_deps/googletest-src/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gate_build20/src/CMakeFiles/CardLib.dir/DependInfo.cmake"
+  "/root/repo/_gate_build20/src/CMakeFiles/blackjack_c.dir/DependInfo.cmake"
+  "/root/repo/_gate_build20/build/_deps/googletest-src/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blackjacktests.dir/AllocationHooks.cpp.o"
+  "CMakeFiles/blackjacktests.dir/AllocationHooks.cpp.o.d"
+  "CMakeFiles/blackjacktests.dir/blackjacktests.cpp.o"
+  "CMakeFiles/blackjacktests.dir/blackjacktests.cpp.o.d"
+  "blackjacktests"
+  "blackjacktests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blackjacktests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
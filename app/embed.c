@@ -0,0 +1,67 @@
+/**
+ * @file embed.c
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Example of calling the engine from C through blackjack_c.h: plays rounds in large
+ *        batches into caller arrays and prints each seat's win and bust rate.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <blackjack_c.h>
+
+/* Rounds played per call, so the call cost is spread over many rounds */
+#define BATCH 4096
+#define SEATS 4
+
+int main(int argc, char **argv)
+{
+    static int32_t scores[BATCH * SEATS];
+    static uint8_t winners[BATCH * SEATS];
+    static uint8_t busted[BATCH * SEATS];
+    const int thresholds[SEATS] = {15, 16, 17, 18};
+    uint64_t rounds = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    uint64_t wins[SEATS] = {0};
+    uint64_t busts[SEATS] = {0};
+    uint64_t played = 0;
+    bj_engine *engine = NULL;
+    int status;
+    int i;
+
+    status = bj_engine_create(42, SEATS, thresholds, 1, &engine);
+    if (status != BJ_OK)
+    {
+        printf("bj_engine_create: %s\n", bj_status_string(status));
+        return 1;
+    }
+
+    while (played < rounds)
+    {
+        uint64_t batch = rounds - played < BATCH ? rounds - played : BATCH;
+        uint64_t r;
+        status = bj_play_rounds(engine, played, batch, scores, winners, busted);
+        if (status != BJ_OK)
+        {
+            printf("bj_play_rounds: %s\n", bj_status_string(status));
+            bj_engine_destroy(engine);
+            return 1;
+        }
+        for (r = 0; r < batch * SEATS; r++)
+        {
+            wins[r % SEATS] += winners[r];
+            busts[r % SEATS] += busted[r];
+        }
+        played += batch;
+    }
+
+    printf("Interface version %d, %llu rounds\n", bj_api_version(), (unsigned long long)played);
+    for (i = 0; i < SEATS; i++)
+    {
+        printf("Seat %d threshold %d: win %.2f%%, bust %.2f%%\n", i + 1, thresholds[i],
+               100.0 * wins[i] / played, 100.0 * busts[i] / played);
+    }
+    bj_engine_destroy(engine);
+    return 0;
+}
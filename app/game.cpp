@@ -7,17 +7,497 @@
  *
  *
  */
+#include <chrono>
 #include <iostream>
 #include <iomanip>
+#include <cmath>
 #include <vector>
 #include <utils.h>
+#include <BankrollSimulator.h>
 #include <Card.h>
+#include <DealerTable.h>
+#include <Pipeline.h>
+#include <HandHistory.h>
+#include <MultiCounter.h>
+#include <Round.h>
+#include <RuinCalculator.h>
+#include <ShuffleKernel.h>
+#include <ThresholdModel.h>
+#include <ThresholdSweep.h>
+#include <Tournament.h>
+#include <WhatIf.h>
 
 using namespace std;
 using namespace chants;
 
+// Read argv[index] as a number, or use fallback when it is missing or not a number
+int NumberArgument(int argc, char **argv, int index, int fallback)
+{
+    if (index < argc && isANumber(argv[index]))
+        return stoi(argv[index]);
+    return fallback;
+}
+
+// Print the work, starve and block time of one pipeline stage
+void ShowStage(const string &name, const StageStats &stats)
+{
+    cout << setw(10) << right << name << setw(8) << stats.threads << setw(10) << stats.items
+         << setw(10) << fixed << setprecision(3) << stats.busyNanos / 1e9
+         << setw(10) << stats.starvedNanos / 1e9
+         << setw(10) << stats.blockedNanos / 1e9
+         << setw(16) << setprecision(0) << stats.ThroughputPerThread() << endl;
+}
+
+// blackjack pipeline <rounds> <seats> <shuffler threads> <player threads> [threshold] [precision in 1/10000]
+int RunPipeline(int argc, char **argv)
+{
+    PipelineConfig config;
+    config.rounds = NumberArgument(argc, argv, 2, 1000000);
+    int seats = NumberArgument(argc, argv, 3, 4);
+    config.shufflerThreads = NumberArgument(argc, argv, 4, 1);
+    config.playerThreads = NumberArgument(argc, argv, 5, 1);
+    config.thresholds.assign(seats, NumberArgument(argc, argv, 6, 17));
+    config.seed = time(nullptr);
+    config.earlyStop.halfWidth = NumberArgument(argc, argv, 7, 0) / 10000.0;
+
+    PipelineReport report = Pipeline(config).Run();
+    const SimulationStats &stats = report.stats;
+
+    cout << "Rounds: " << stats.Rounds() << " in " << report.seconds << " s ("
+         << fixed << setprecision(0) << stats.Rounds() / report.seconds << " rounds/s)"
+         << (report.stoppedEarly ? ", stopped at the requested precision" : "") << endl;
+    cout << "\n";
+    cout << setw(10) << right << "Stage" << setw(8) << "Threads" << setw(10) << "Slots" << setw(10) << "Busy s"
+         << setw(10) << "Starved s" << setw(10) << "Blocked s" << setw(16) << "Slots/s/thread" << endl;
+    ShowStage("shuffle", report.shuffle);
+    ShowStage("play", report.play);
+    ShowStage("aggregate", report.aggregate);
+    cout << "\n";
+    for (int i = 0; i < seats; i++)
+    {
+        cout << "Seat " << i + 1 << ": win " << setprecision(4) << 100.0 * stats.Wins(i).Mean()
+             << "% +/- " << 100.0 * stats.Wins(i).HalfWidth(1.96)
+             << "%, bust " << 100.0 * stats.Busts(i) / stats.Rounds()
+             << "%, mean score " << stats.Scores(i).Mean() << " (sd " << sqrt(stats.Scores(i).Variance()) << ")"
+             << ", longest win streak " << stats.LongestWinStreak(i) << endl;
+    }
+    return 0;
+}
+
+// blackjack round <seed> <round> <seats> [threshold]
+// Regenerate and show one round of a seeded run, for example one played by the pipeline
+int RunRound(int argc, char **argv)
+{
+    if (argc < 5 || !isANumber(argv[2]) || !isANumber(argv[3]))
+    {
+        cout << "Usage: blackjack round <seed> <round> <seats> [threshold]" << endl;
+        return -1;
+    }
+
+    uint64_t seed = stoull(argv[2]);
+    uint64_t round = stoull(argv[3]);
+    int seats = NumberArgument(argc, argv, 4, 4);
+    int threshold = NumberArgument(argc, argv, 5, 17);
+
+    vector<Player> players;
+    for (int i = 0; i < seats; i++)
+    {
+        players.push_back(Player("Seat" + to_string(i + 1), threshold));
+    }
+    Deck deck = Deck::Seeded(seed, round);
+    PlayBlackJack(players, deck);
+    SortPlayers(players);
+    DetermineOutcomeOfGame(players);
+    return 0;
+}
+
+// blackjack record <file> <rounds> <seats> [threshold] [seed]
+// Play seeded rounds and append every hand to a binary hand history log
+int RunRecord(int argc, char **argv)
+{
+    if (argc < 5)
+    {
+        cout << "Usage: blackjack record <file> <rounds> <seats> [threshold] [seed]" << endl;
+        return -1;
+    }
+
+    uint64_t rounds = NumberArgument(argc, argv, 3, 100000);
+    int seats = NumberArgument(argc, argv, 4, 4);
+    vector<int> thresholds(seats, NumberArgument(argc, argv, 5, 17));
+    uint64_t seed = argc > 6 && isANumber(argv[6]) ? stoull(argv[6]) : time(nullptr);
+
+    HandHistoryWriter writer(argv[2]);
+    vector<SeatResult> results(seats);
+    uint8_t shoe[CardsPerDeck];
+    for (uint64_t round = 0; round < rounds; round++)
+    {
+        ShuffleKernel::ShuffleRound(seed, round, shoe, 1);
+        if (PlayRound(shoe, CardsPerDeck, thresholds.data(), seats, results.data()) < 0)
+        {
+            cout << "OVER DELT!" << endl;
+            return -1;
+        }
+        writer.WriteRound(round, shoe, thresholds.data(), results.data(), seats);
+    }
+    writer.Flush();
+
+    cout << "Seed: " << seed << endl;
+    cout << "Wrote " << writer.Records() << " hands to " << argv[2] << endl;
+    return 0;
+}
+
+// blackjack whatif <threshold> [threshold ...]
+// Exact win and bust chances of each seat with an infinite deck, no simulation needed
+int RunWhatIf(int argc, char **argv)
+{
+    vector<int> thresholds;
+    for (int i = 2; i < argc; i++)
+    {
+        thresholds.push_back(NumberArgument(argc, argv, i, 17));
+    }
+    if (thresholds.empty())
+    {
+        cout << "Usage: blackjack whatif <threshold> [threshold ...]" << endl;
+        return -1;
+    }
+
+    vector<double> wins = ThresholdModel::WinProbabilities(thresholds);
+    cout << setw(10) << right << "Seat" << setw(10) << "Threshold" << setw(10) << "Win %" << setw(10) << "Bust %" << endl;
+    for (size_t i = 0; i < thresholds.size(); i++)
+    {
+        cout << setw(10) << i + 1 << setw(10) << thresholds[i] << fixed << setprecision(2)
+             << setw(10) << 100 * wins[i] << setw(10) << 100 * ThresholdModel::BustProbability(thresholds[i]) << endl;
+    }
+    return 0;
+}
+
+// blackjack count <rounds> <seats> [decks] [threshold] [seed]
+// Deal a multi-deck shoe until the cut card and let every counting system bet seat 1's hands
+int RunCount(int argc, char **argv)
+{
+    int rounds = NumberArgument(argc, argv, 2, 100000);
+    int seats = NumberArgument(argc, argv, 3, 4);
+    int decks = NumberArgument(argc, argv, 4, 6);
+    int threshold = NumberArgument(argc, argv, 5, 17);
+    uint64_t seed = argc > 6 && isANumber(argv[6]) ? stoull(argv[6]) : time(nullptr);
+
+    // Reshuffle at 75% penetration, or sooner if the rest could not finish a round
+    const int shoeCards = decks * CardsPerDeck;
+    const int cut = max(shoeCards / 4, seats * 21 + 1);
+    if (seats < 1 || cut >= shoeCards)
+    {
+        cout << "Usage: blackjack count <rounds> <seats> [decks] [threshold] [seed], with room in the shoe for a round" << endl;
+        return -1;
+    }
+
+    MultiCounter counter(StandardCountingSystems(), decks);
+    vector<uint8_t> shoe(shoeCards);
+    uint64_t shoes = 0;
+    Deck deck = Deck::FromCodes(shoe.data(), 0);
+    for (int round = 0; round < rounds; round++)
+    {
+        if (deck.CardsInDeck() < cut)
+        {
+            ShuffleKernel::ShuffleRound(seed, shoes++, shoe.data(), decks);
+            deck = Deck::FromCodes(shoe.data(), shoeCards);
+            counter.Shuffle();
+        }
+
+        counter.PlaceBets();
+        vector<Player> players;
+        for (int i = 0; i < seats; i++)
+        {
+            players.push_back(Player("Seat" + to_string(i + 1), threshold));
+        }
+        CountedDeck<Deck> counted(deck, counter);
+        PlayBlackJack(players, counted);
+
+        // Seat 1 wins when it did not bust and nobody beat its score, as in SortPlayers
+        bool won = players[0].Score() <= 21;
+        for (int i = 1; i < seats && won; i++)
+        {
+            if (players[i].Score() <= 21 && players[i].Score() > players[0].Score())
+                won = false;
+        }
+        counter.SettleRound(won ? 1.0 : -1.0);
+    }
+
+    cout << "Rounds: " << rounds << ", shoes: " << shoes << ", seed: " << seed << endl;
+    cout << setw(14) << right << "System" << setw(12) << "Wagered" << setw(12) << "Net" << setw(10) << "Yield %"
+         << setw(18) << "Units/round" << endl;
+    for (size_t s = 0; s < counter.Systems(); s++)
+    {
+        const RunningStats &results = counter.Results(s);
+        double net = results.Mean() * results.Count();
+        cout << setw(14) << counter.System(s).name << setw(12) << counter.Wagered(s) << fixed << setprecision(0)
+             << setw(12) << net << setprecision(3) << setw(10) << 100 * net / counter.Wagered(s)
+             << setw(10) << results.Mean() << " +/- " << results.HalfWidth(1.96) << endl;
+    }
+    return 0;
+}
+
+// blackjack dealer <rounds> <seats> [bankroll] [bet] [seed]
+// Play basic strategy against a dealer for money and show each seat's bankroll
+int RunDealer(int argc, char **argv)
+{
+    int rounds = NumberArgument(argc, argv, 2, 1000);
+    int seats = NumberArgument(argc, argv, 3, 4);
+    int bankroll = NumberArgument(argc, argv, 4, 1000);
+    int bet = NumberArgument(argc, argv, 5, 10);
+    uint64_t seed = argc > 6 && isANumber(argv[6]) ? stoull(argv[6]) : time(nullptr);
+    if (seats < 1 || bet < 1)
+    {
+        cout << "Usage: blackjack dealer <rounds> <seats> [bankroll] [bet] [seed]" << endl;
+        return -1;
+    }
+
+    DealerTable table(DealerRules(), seed);
+    for (int i = 0; i < seats; i++)
+    {
+        table.Join(bankroll);
+    }
+    vector<double> bets(seats, bet);
+    vector<int> playedUntil(seats, rounds);
+    for (int round = 0; round < rounds; round++)
+    {
+        table.PlayRound(bets.data());
+        for (int i = 0; i < seats; i++)
+        {
+            if (playedUntil[i] == rounds && table.Bankroll(i) < bet)
+                playedUntil[i] = round + 1;
+        }
+    }
+
+    cout << "Rounds: " << rounds << ", shoes: " << table.Shoes() << ", seed: " << seed << endl;
+    cout << setw(10) << right << "Seat" << setw(12) << "Bankroll" << setw(12) << "Net" << setw(12) << "Rounds" << endl;
+    for (int i = 0; i < seats; i++)
+    {
+        cout << setw(10) << i + 1 << fixed << setprecision(1) << setw(12) << table.Bankroll(i)
+             << setw(12) << table.Bankroll(i) - bankroll << setw(12) << playedUntil[i]
+             << (playedUntil[i] < rounds ? "  broke" : "") << endl;
+    }
+    return 0;
+}
+
+// blackjack bankroll <sessions> <hours> [bankroll in units] [hands per hour] [seed]
+// Measure a basic strategy table's hands, then follow many sessions' bankrolls
+int RunBankroll(int argc, char **argv)
+{
+    SessionConfig config;
+    config.paths = argc > 2 && isANumber(argv[2]) ? stoull(argv[2]) : 1000000;
+    config.hours = NumberArgument(argc, argv, 3, 4);
+    config.bankroll = NumberArgument(argc, argv, 4, 100);
+    config.handsPerHour = NumberArgument(argc, argv, 5, 100);
+    config.seed = argc > 6 && isANumber(argv[6]) ? stoull(argv[6]) : time(nullptr);
+
+    const uint64_t measuredRounds = 1000000;
+    BankrollSimulator simulator = BankrollSimulator::FromTable(DealerRules(), 1, measuredRounds, config.seed);
+    cout << "Per hand over " << measuredRounds << " dealt hands: mean " << fixed << setprecision(4)
+         << simulator.MeanPerHand() << " units, sd " << sqrt(simulator.VariancePerHand()) << endl;
+
+    auto start = chrono::steady_clock::now();
+    SessionReport report = simulator.Run(config);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Sessions: " << report.paths << " of " << config.hours << " h, " << report.hands << " hands in "
+         << setprecision(3) << seconds << " s (" << setprecision(0) << report.hands / seconds << " hands/s)" << endl;
+    cout << "Hourly win: " << setprecision(3) << report.hourly.Mean() << " units +/- " << report.hourly.HalfWidth(1.96)
+         << ", sd " << sqrt(report.hourly.Variance()) << endl;
+    cout << "Final bankroll: " << report.final.Mean() << " units, sd " << sqrt(report.final.Variance()) << endl;
+    RuinCalculator calculator(simulator.Outcomes(), simulator.Probabilities());
+    SessionDistribution exact = calculator.Session(config.bankroll, static_cast<uint64_t>(config.hours) * config.handsPerHour,
+                                                   simulator.Floor());
+    cout << "Risk of ruin: " << 100 * report.ruin << "%, exact " << setprecision(6) << 100 * exact.Ruin() << "%" << endl;
+    cout << "Drawdown: median " << setprecision(1) << report.DrawdownPercentile(0.5) << ", 90% "
+         << report.DrawdownPercentile(0.9) << ", 99% " << report.DrawdownPercentile(0.99) << " units" << endl;
+    return 0;
+}
+
+// blackjack thresholds <rounds> <seats> [seed]
+// Play every round at all 21 thresholds from one walk per seat, and time it against
+// one PlayRound pass per threshold
+int RunThresholds(int argc, char **argv)
+{
+    int rounds = NumberArgument(argc, argv, 2, 100000);
+    int seats = NumberArgument(argc, argv, 3, 4);
+    uint64_t seed = argc > 4 && isANumber(argv[4]) ? stoull(argv[4]) : time(nullptr);
+    if (seats < 1)
+    {
+        cout << "Usage: blackjack thresholds <rounds> <seats> [seed]" << endl;
+        return -1;
+    }
+
+    uint8_t shoe[CardsPerDeck];
+    ThresholdStudy study(seats);
+    auto start = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++)
+    {
+        ShuffleKernel::ShuffleRound(seed, round, shoe, 1);
+        study.AddShoe(shoe, CardsPerDeck);
+    }
+    double sweepSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // The same study the long way, for the timing
+    ThresholdStudy separate(seats);
+    vector<SeatResult> results(seats);
+    vector<int> thresholds(seats);
+    start = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++)
+    {
+        ShuffleKernel::ShuffleRound(seed, round, shoe, 1);
+        for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+        {
+            fill(thresholds.begin(), thresholds.end(), threshold);
+            if (PlayRound(shoe, CardsPerDeck, thresholds.data(), seats, results.data()) >= 0)
+                separate.AddRound(threshold, results.data());
+        }
+    }
+    double separateSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Rounds: " << rounds << " x " << MaxThreshold << " thresholds, seed: " << seed << endl;
+    cout << "One walk per seat start: " << fixed << setprecision(3) << sweepSeconds << " s, "
+         << setprecision(2) << static_cast<double>(study.Sweeps()) / rounds << " walks per shoe" << endl;
+    cout << "One PlayRound per threshold: " << setprecision(3) << separateSeconds << " s" << endl;
+    cout << setw(10) << right << "Threshold" << setw(12) << "Seat 1 win" << setw(10) << "Bust %"
+         << setw(12) << "Mean score" << setw(12) << "Over dealt" << endl;
+    for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+    {
+        double played = static_cast<double>(max<uint64_t>(1, study.Rounds(threshold)));
+        cout << setw(10) << threshold << setprecision(2) << setw(11) << 100 * study.Wins(threshold, 0) / played << "%"
+             << setw(10) << 100 * study.Busts(threshold, 0) / played
+             << setw(12) << study.MeanScore(threshold, 0) << setw(12) << study.OverDealt(threshold) << endl;
+    }
+    return 0;
+}
+
+// blackjack replay <seats> <seat> <threshold> [decks] [seed]
+// Play one round at threshold 17, then show it again as if one seat had played another threshold
+int RunReplay(int argc, char **argv)
+{
+    int seats = NumberArgument(argc, argv, 2, 100);
+    int seat = NumberArgument(argc, argv, 3, 1) - 1;
+    int threshold = NumberArgument(argc, argv, 4, 15);
+    int decks = NumberArgument(argc, argv, 5, (seats * 4) / CardsPerDeck + 1);
+    uint64_t seed = argc > 6 && isANumber(argv[6]) ? stoull(argv[6]) : time(nullptr);
+    if (seats < 1 || seat < 0 || seat >= seats || threshold < 1 || threshold > 21 || decks < 1)
+    {
+        cout << "Usage: blackjack replay <seats> <seat> <threshold> [decks] [seed]" << endl;
+        return -1;
+    }
+
+    vector<uint8_t> shoe(CardsPerDeck * decks);
+    ShuffleKernel::ShuffleRound(seed, 0, shoe.data(), decks);
+    vector<Player> players;
+    for (int i = 0; i < seats; i++)
+        players.push_back(Player("Seat" + to_string(i + 1), 17));
+    Deck deck = Deck::FromCodes(shoe.data(), static_cast<int>(shoe.size()));
+    RoundRecord record(deck);
+    PlayBlackJack(players, deck, &record);
+    WhatIfRound whatIf(record);
+
+    // The long way: a new deck and new players, dealt again and sorted
+    auto start = chrono::steady_clock::now();
+    vector<Player> replayed;
+    for (int i = 0; i < seats; i++)
+        replayed.push_back(Player("Seat" + to_string(i + 1), i == seat ? threshold : 17));
+    Deck replayDeck = Deck::FromCodes(shoe.data(), static_cast<int>(shoe.size()));
+    PlayBlackJack(replayed, replayDeck);
+    SortPlayers(replayed);
+    double replaySeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    int changed = whatIf.SetThreshold(seat, threshold);
+    double whatIfSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (changed < 0)
+    {
+        cout << "OVER DELT! Seat " << seat + 1 << " at " << threshold << " runs the shoe out" << endl;
+        return -2;
+    }
+
+    cout << "Seats: " << seats << ", decks: " << decks << ", seed: " << seed << endl;
+    cout << "Seat " << seat + 1 << " at " << threshold << " instead of 17 changes " << changed << " seat"
+         << (changed == 1 ? "" : "s") << ", best score " << whatIf.BestScore() << endl;
+    cout << "Re-evaluated in " << fixed << setprecision(2) << whatIfSeconds * 1e6 << " us, replayed in "
+         << replaySeconds * 1e6 << " us" << endl;
+    cout << setw(10) << right << "Seat" << setw(10) << "Before" << setw(10) << "After" << setw(10) << "Result" << endl;
+    for (int i = seat; i < seat + max(changed, 1); i++)
+    {
+        const char *result = whatIf.IsBusted(i) ? "BUSTED" : (whatIf.IsWinner(i) ? "WINNER" : "");
+        cout << setw(10) << i + 1 << setw(10) << record.seats[i].score << setw(10) << whatIf.Seat(i).score
+             << setw(10) << result << endl;
+    }
+    return 0;
+}
+
+// blackjack tournament <entrants> [seats] [seed] [threshold ...]
+// Play an elimination bracket: each round the winners of every table are seated at new tables
+int RunTournament(int argc, char **argv)
+{
+    TournamentConfig config;
+    config.entrants = argc > 2 && isANumber(argv[2]) ? stoull(argv[2]) : 10000;
+    config.seatsPerTable = NumberArgument(argc, argv, 3, 6);
+    config.seed = argc > 4 && isANumber(argv[4]) ? stoull(argv[4]) : time(nullptr);
+    if (argc > 5)
+    {
+        config.thresholds.clear();
+        for (int i = 5; i < argc; i++)
+            config.thresholds.push_back(NumberArgument(argc, argv, i, 17));
+    }
+    bool badThreshold = false;
+    for (int threshold : config.thresholds)
+        badThreshold |= threshold < 1 || threshold > 21;
+    if (config.entrants == 0 || config.seatsPerTable < 2 || config.seatsPerTable > Tournament::MaxSeatsPerTable ||
+        badThreshold)
+    {
+        cout << "Usage: blackjack tournament <entrants> [seats, 2 - " << Tournament::MaxSeatsPerTable
+             << "] [seed] [threshold 1 - 21 ...]" << endl;
+        return -1;
+    }
+
+    Tournament tournament(config);
+    tournament.Run();
+
+    cout << "Entrants: " << config.entrants << ", seed: " << config.seed << endl;
+    cout << setw(8) << right << "Round" << setw(12) << "Players" << setw(10) << "Tables" << setw(12) << "Survivors" << setw(10) << "ms" << endl;
+    for (size_t i = 0; i < tournament.Rounds().size(); i++)
+    {
+        const TournamentRound &round = tournament.Rounds()[i];
+        cout << setw(8) << i + 1 << setw(12) << round.players << setw(10) << round.tables << setw(12) << round.survivors
+             << setw(10) << fixed << setprecision(2) << 1000 * round.seconds << endl;
+    }
+    cout << "\n";
+    for (uint32_t champion : tournament.Survivors())
+    {
+        PooledPlayer &player = tournament.Entrant(champion);
+        cout << "Champion: " << player.GetName().str() << ", threshold " << player.GetThreshold()
+             << ", final score " << player.Score() << ", " << tournament.RoundsWon(champion) << " rounds won" << endl;
+    }
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
+    if (argc >= 2 && string(argv[1]) == "pipeline")
+        return RunPipeline(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "round")
+        return RunRound(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "record")
+        return RunRecord(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "whatif")
+        return RunWhatIf(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "count")
+        return RunCount(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "dealer")
+        return RunDealer(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "bankroll")
+        return RunBankroll(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "thresholds")
+        return RunThresholds(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "replay")
+        return RunReplay(argc, argv);
+    if (argc >= 2 && string(argv[1]) == "tournament")
+        return RunTournament(argc, argv);
+
     // Default threshold if no argv
     int threshold = 17;
     if (argc == 2 && isANumber(argv[1]))
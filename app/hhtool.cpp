@@ -0,0 +1,129 @@
+/**
+ * @file hhtool.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Command line tool for binary hand history logs. It summarizes a log per seat, or replays
+ *        the hands of one round the way the game shows them.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <Card.h>
+#include <CardCode.h>
+#include <HandHistory.h>
+
+using namespace std;
+using namespace chants;
+
+// Print the usage of the tool
+int Usage()
+{
+    cout << "Usage: hhtool summary <file>" << endl;
+    cout << "       hhtool replay <file> <round>" << endl;
+    return -1;
+}
+
+// Count hands, wins, busts and the mean score of every seat in the log
+int Summary(const HandHistoryReader &log)
+{
+    vector<uint64_t> hands;
+    vector<uint64_t> wins;
+    vector<uint64_t> busts;
+    vector<uint64_t> points;
+    uint64_t lastRound = 0;
+    uint64_t rounds = 0;
+
+    for (const HandRecord &record : log)
+    {
+        if (record.seat >= hands.size())
+        {
+            hands.resize(record.seat + 1);
+            wins.resize(record.seat + 1);
+            busts.resize(record.seat + 1);
+            points.resize(record.seat + 1);
+        }
+        if (rounds == 0 || record.round != lastRound)
+        {
+            rounds++;
+            lastRound = record.round;
+        }
+        hands[record.seat]++;
+        wins[record.seat] += record.outcome == HandWon;
+        busts[record.seat] += record.outcome == HandBusted;
+        points[record.seat] += record.score;
+    }
+
+    cout << "Hands: " << log.Count() << ", rounds: " << rounds << endl;
+    cout << setw(10) << right << "Seat" << setw(12) << "Hands" << setw(10) << "Win %" << setw(10) << "Bust %" << setw(12) << "Mean score" << endl;
+    for (size_t seat = 0; seat < hands.size(); seat++)
+    {
+        if (hands[seat] == 0)
+            continue;
+        cout << setw(10) << seat + 1 << setw(12) << hands[seat] << fixed << setprecision(2)
+             << setw(10) << 100.0 * wins[seat] / hands[seat]
+             << setw(10) << 100.0 * busts[seat] / hands[seat]
+             << setw(12) << static_cast<double>(points[seat]) / hands[seat] << endl;
+    }
+    return 0;
+}
+
+// Show every hand of one round with its cards
+int Replay(const HandHistoryReader &log, uint64_t round)
+{
+    bool found = false;
+    cout << setw(10) << right << "Seat" << setw(10) << right << "Score" << right << setw(10) << "Results" << " " << left << setw(30) << "Hand" << endl;
+    cout << setw(10) << right << "------" << setw(10) << right << "-----" << right << setw(10) << "-------" << " " << left << setw(30) << "------------------------------" << endl;
+
+    for (const HandRecord &record : log)
+    {
+        if (record.round != round)
+            continue;
+        found = true;
+
+        string hand = "";
+        int kept = record.cardCount < HandRecord::MaxCards ? record.cardCount : HandRecord::MaxCards;
+        for (int i = 0; i < kept; i++)
+        {
+            hand += Card(CodeToValue(record.cards[i]), CodeToSuit(record.cards[i]), true).ToString() + " ";
+        }
+        if (kept < record.cardCount)
+            hand += "...";
+
+        string result = record.outcome == HandBusted ? "BUSTED" : (record.outcome == HandWon ? "WINNER" : "");
+        cout << setw(10) << right << record.seat + 1 << setw(10) << right << static_cast<int>(record.score)
+             << setw(10) << result << setw(1) << "" << left << setw(30) << hand << endl;
+    }
+
+    if (!found)
+    {
+        cout << "Round " << round << " is not in the log" << endl;
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        return Usage();
+
+    try
+    {
+        string command = argv[1];
+        HandHistoryReader log(argv[2]);
+        if (command == "summary")
+            return Summary(log);
+        if (command == "replay" && argc == 4)
+            return Replay(log, stoull(argv[3]));
+        return Usage();
+    }
+    catch (const std::exception &e)
+    {
+        cout << e.what() << endl;
+        return -1;
+    }
+}
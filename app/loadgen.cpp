@@ -0,0 +1,180 @@
+/**
+ * @file loadgen.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Load generator for the game server. Every connection opens its tables, plays rounds
+ *        on them in turn and closes them, timing every action. Prints p50 and p99 action
+ *        latency and the tables served per second.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std;
+
+// A blocking client connection that sends one line and waits for one reply line
+class Client
+{
+private:
+    int _fd;
+    string _pending;
+
+public:
+    explicit Client(const string &where)
+    {
+        if (where.find_first_not_of("0123456789") == string::npos)
+        {
+            sockaddr_in address;
+            memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(stoi(where));
+            _fd = socket(AF_INET, SOCK_STREAM, 0);
+            int on = 1;
+            setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+            if (connect(_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+                throw runtime_error("Can not connect to port " + where);
+        }
+        else
+        {
+            sockaddr_un address;
+            memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            strncpy(address.sun_path, where.c_str(), sizeof(address.sun_path) - 1);
+            _fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (connect(_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+                throw runtime_error("Can not connect to " + where);
+        }
+    }
+
+    ~Client()
+    {
+        close(_fd);
+    }
+
+    // Send a request line and return the reply line without its newline
+    string Request(const string &line)
+    {
+        string request = line + "\n";
+        size_t sent = 0;
+        while (sent < request.size())
+        {
+            ssize_t written = send(_fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+            if (written <= 0)
+                throw runtime_error("Connection lost");
+            sent += written;
+        }
+
+        size_t end;
+        char chunk[4096];
+        while ((end = _pending.find('\n')) == string::npos)
+        {
+            ssize_t got = recv(_fd, chunk, sizeof(chunk), 0);
+            if (got <= 0)
+                throw runtime_error("Connection lost");
+            _pending.append(chunk, got);
+        }
+        string reply = _pending.substr(0, end);
+        _pending.erase(0, end + 1);
+        return reply;
+    }
+};
+
+// Time one request and keep its latency in nanoseconds
+string Timed(Client &client, const string &line, vector<uint64_t> &latencies)
+{
+    auto start = chrono::steady_clock::now();
+    string reply = client.Request(line);
+    latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    if (reply.compare(0, 3, "ERR") == 0)
+        throw runtime_error("Server refused " + line + ": " + reply);
+    return reply;
+}
+
+// bjload <port | unix socket path> <connections> <tables per connection> <rounds per table> [seats]
+int main(int argc, char **argv)
+{
+    if (argc < 5)
+    {
+        cout << "Usage: bjload <port | unix socket path> <connections> <tables per connection> <rounds per table> [seats]" << endl;
+        return -1;
+    }
+    string where = argv[1];
+    int connections = stoi(argv[2]);
+    int tables = stoi(argv[3]);
+    int rounds = stoi(argv[4]);
+    int seats = argc > 5 ? stoi(argv[5]) : 4;
+
+    vector<vector<uint64_t>> latencies(connections);
+    vector<string> errors(connections);
+    vector<thread> threads;
+    auto start = chrono::steady_clock::now();
+
+    for (int c = 0; c < connections; c++)
+    {
+        threads.emplace_back([&, c]()
+                             {
+            try
+            {
+                Client client(where);
+                vector<string> ids;
+                latencies[c].reserve(static_cast<size_t>(tables) * (rounds + 2));
+                for (int t = 0; t < tables; t++)
+                    ids.push_back(Timed(client, "OPEN " + to_string(seats) + " 17", latencies[c]).substr(3));
+                for (int r = 0; r < rounds; r++)
+                {
+                    for (const string &id : ids)
+                        Timed(client, "PLAY " + id, latencies[c]);
+                }
+                for (const string &id : ids)
+                    Timed(client, "CLOSE " + id, latencies[c]);
+            }
+            catch (const std::exception &e)
+            {
+                errors[c] = e.what();
+            } });
+    }
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    for (const string &error : errors)
+    {
+        if (!error.empty())
+        {
+            cout << error << endl;
+            return -1;
+        }
+    }
+
+    vector<uint64_t> all;
+    for (const vector<uint64_t> &part : latencies)
+        all.insert(all.end(), part.begin(), part.end());
+    sort(all.begin(), all.end());
+
+    cout << "Actions: " << all.size() << " in " << fixed << setprecision(3) << seconds << " s ("
+         << setprecision(0) << all.size() / seconds << " actions/s)" << endl;
+    cout << "Latency p50: " << setprecision(1) << all[all.size() / 2] / 1000.0 << " us, p99: "
+         << all[all.size() * 99 / 100] / 1000.0 << " us, max: " << all.back() / 1000.0 << " us" << endl;
+    cout << "Tables served: " << static_cast<long>(connections) * tables << " ("
+         << setprecision(0) << connections * static_cast<double>(tables) / seconds << " tables/s, "
+         << connections * static_cast<double>(tables) * rounds / seconds << " rounds/s)" << endl;
+    return 0;
+}
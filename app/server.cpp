@@ -0,0 +1,68 @@
+/**
+ * @file server.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Game server executable. Hosts game tables over loopback TCP or a Unix domain socket
+ *        until it is interrupted, then prints what it served.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <csignal>
+#include <iostream>
+#include <string>
+#include <GameServer.h>
+
+using namespace std;
+using namespace chants;
+
+// The running server, for the signal handler
+GameServer *runningServer = nullptr;
+
+// Stop the server on Ctrl-C or kill
+void HandleSignal(int)
+{
+    if (runningServer != nullptr)
+        runningServer->Stop();
+}
+
+// bjserver [port | unix socket path] [threads]
+int main(int argc, char **argv)
+{
+    ServerConfig config;
+    if (argc > 1)
+    {
+        string where = argv[1];
+        if (where.find_first_not_of("0123456789") == string::npos)
+            config.port = stoi(where);
+        else
+            config.unixPath = where;
+    }
+    if (argc > 2)
+        config.threads = stoi(argv[2]);
+
+    try
+    {
+        GameServer server(config);
+        runningServer = &server;
+        signal(SIGINT, HandleSignal);
+        signal(SIGTERM, HandleSignal);
+
+        if (config.unixPath.empty())
+            cout << "Listening on 127.0.0.1:" << server.Port() << endl;
+        else
+            cout << "Listening on " << config.unixPath << endl;
+        server.Run();
+        runningServer = nullptr;
+
+        ServerStats stats = server.Stats();
+        cout << "Connections: " << stats.connections << ", tables: " << stats.tables
+             << ", rounds: " << stats.rounds << ", requests: " << stats.requests << endl;
+    }
+    catch (const std::exception &e)
+    {
+        cout << e.what() << endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file strategygen.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Command line tool that solves basic strategy for a set of table rules and writes it as a
+ *        header of constexpr tables, which is how inc/BasicStrategy.h is made.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <StrategySolver.h>
+
+using namespace std;
+using namespace chants;
+
+// Print the usage of the tool
+int Usage()
+{
+    cout << "Usage: strategygen <decks> <s17 | h17> [das | nodas] [output header]" << endl;
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        return Usage();
+
+    try
+    {
+        StrategyRules rules;
+        rules.decks = stoi(argv[1]);
+        string soft17 = argv[2];
+        if (soft17 != "s17" && soft17 != "h17")
+            return Usage();
+        rules.dealerHitsSoft17 = soft17 == "h17";
+        if (argc > 3)
+        {
+            string split = argv[3];
+            if (split != "das" && split != "nodas")
+                return Usage();
+            rules.doubleAfterSplit = split == "das";
+        }
+
+        auto start = chrono::steady_clock::now();
+        StrategySolver solver(rules);
+        solver.Solve();
+        double millis = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        if (argc > 4)
+        {
+            ofstream out(argv[4]);
+            if (!out)
+                throw runtime_error(string("Could not open ") + argv[4]);
+            solver.WriteHeader(out);
+            cerr << "Solved in " << millis << " ms, wrote " << argv[4] << endl;
+        }
+        else
+            solver.WriteHeader(cout);
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        cerr << e.what() << endl;
+        return -1;
+    }
+}
@@ -12,7 +12,10 @@
 #include <algorithm> // Required for sorting functionality
 #include <Card.h>    // Custom Card class used in game mechanics
 #include <Deck.h>    // Custom Deck class for deck operations
+#include <InfiniteDeck.h> // Card source that draws with replacement
 #include <Player.h>  // Custom Player class representing game participants
+#include <Seat.h>    // Rules of a seat and of the winners, shared with the library
+#include <WhatIf.h>  // Record of a round for what-if re-evaluation
 
 namespace chants
 {
@@ -42,20 +45,8 @@ namespace chants
         // Use comparator function to sort players by their scores
         sort(players.begin(), players.end(), &comparator);
 
-        int highestScore = 0;
-        for (int i = 0; i < players.size(); i++)
-        {
-            // Check if player score is within allowed limit (21)
-            if (players[i].Score() <= 21)
-            {
-                // Update highest score and mark player as winner if eligible
-                if (players[i].Score() >= highestScore)
-                {
-                    players[i].isWinner = true;
-                    highestScore = players[i].Score();
-                }
-            }
-        }
+        // Mark every player with the highest score of 21 or less as a winner
+        MarkWinners(players);
     }
 
     // Function to gather player information and initialize Player objects
@@ -79,48 +70,31 @@ namespace chants
         }
     }
 
-    // Function to execute each player's game actions in BlackJack
-    void PlayBlackJack(vector<Player> &players, Deck &deck)
+    // Function to execute each player's game actions in BlackJack, dealing from a Deck or an InfiniteDeck
+    // to Players or PooledPlayers, held by value or by pointer. When a record is given, each seat's
+    // threshold, cut point and score are added to it for what-if re-evaluation
+    template <typename TPlayers, typename TDeck>
+    void PlayBlackJack(TPlayers &players, TDeck &deck, RoundRecord *record = nullptr)
     {
-        for (int i = 0; i < players.size(); i++)
+        int dealt = 0; // Cards dealt so far, the next seat's cut point
+        for (size_t i = 0; i < players.size(); i++)
         {
-            // Deal two initial cards to the player
+            auto &player = SeatAt(players[i]);
+            const int first = dealt;
+
+            // Deal two initial cards, draw below the threshold, then mark a bust and reveal the hand
             try
             {
-                players[i].AddCard(deck.Deal());
-                players[i].AddCard(deck.Deal());
+                dealt += PlaySeat(player, deck);
             }
             catch (runtime_error e)
             {
-                cout << "OVER DELT!" << endl; // Error if deck is empty
-                exit(-1);                    // Exit with error code
+                cout << "OVER DELT!" << endl;            // Error if deck is empty
+                exit(player.CountCards() < 2 ? -1 : -2); // Exit with error code, -1 during the deal and -2 drawing
             }
 
-            while (true)
-            {
-                // Continue drawing cards if player's score is below their threshold
-                if (players[i].Score() < players[i].GetThreshold())
-                {
-                    try
-                    {
-                        players[i].AddCard(deck.Deal());
-                    }
-                    catch (runtime_error e)
-                    {
-                        cout << "OVER DELT!" << endl; // Error if deck is empty
-                        exit(-2);                    // Exit with error code
-                    }
-                }
-                else
-                {
-                    // Mark the player as busted if score exceeds 21
-                    if (players[i].Score() > 21)
-                        players[i].isBusted = true;
-
-                    players[i].FlipAllCards(true); // Reveal all cards for this player
-                    break;                         // End the player's turn
-                }
-            }
+            if (record != nullptr)
+                record->AddSeat(player.GetThreshold(), first, dealt - first, player.Score());
         }
     }
 
@@ -0,0 +1,122 @@
+/**
+ * @file allocbench.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Reports the heap allocations, bytes and time each step of a round costs: a Deal, a
+ *        player's round, and a full PlayBlackJack the way game.cpp plays it and with reused
+ *        players and deck.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <utils.h>
+#include <Card.h>
+#include <Deck.h>
+#include <Player.h>
+#include <PlayerPool.h>
+#include "AllocationHooks.h"
+
+using namespace std;
+using namespace chants;
+
+// Run body for ops operations and print allocations, bytes and nanoseconds per operation
+template <typename TBody>
+void Measure(const string &name, uint64_t ops, TBody body)
+{
+    AllocationScope scope;
+    auto start = chrono::steady_clock::now();
+    for (uint64_t op = 0; op < ops; op++)
+        body(op);
+    double nanos = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    AllocationCount count = scope.Count();
+
+    cout << setw(28) << left << name << right << setw(12) << ops << fixed << setprecision(2)
+         << setw(14) << static_cast<double>(count.allocations) / ops
+         << setw(14) << static_cast<double>(count.bytes) / ops
+         << setw(12) << nanos / ops << endl;
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t rounds = argc > 1 && isANumber(argv[1]) ? stoull(argv[1]) : 200000;
+    const int seats = 4;
+    const int threshold = 17;
+
+    cout << setw(28) << left << "Step" << right << setw(12) << "Ops" << setw(14) << "Allocs/op"
+         << setw(14) << "Bytes/op" << setw(12) << "ns/op" << endl;
+
+    Deck deck = Deck::Seeded(1u, 0u);
+    Measure("Deal", rounds, [&](uint64_t op)
+            {
+                if (deck.CardsInDeck() < 2)
+                    deck.Reset(1u, op);
+                deck.Deal();
+            });
+
+    Measure("new Deck", rounds / 10, [](uint64_t op)
+            { Deck fresh = Deck::Seeded(1u, op); });
+
+    Measure("new Player round", rounds, [&](uint64_t op)
+            {
+                if (deck.CardsInDeck() < 12)
+                    deck.Reset(2u, op);
+                Player player("Seat1", threshold);
+                while (player.Score() < threshold)
+                    player.AddCard(deck.Deal());
+            });
+
+    // Long names do not fit in a string's own buffer, so every Player allocates for its name
+    vector<Player> entrants;
+    entrants.reserve(rounds);
+    Measure("new Player, long name", rounds, [&](uint64_t op)
+            { entrants.push_back(Player("Tournament entrant " + to_string(op), threshold)); });
+
+    PlayerPool pool;
+    pool.Reserve(rounds);
+    string name;
+    Measure("PlayerPool Add, long name", rounds, [&](uint64_t op)
+            {
+                name = "Tournament entrant ";
+                name += to_string(op);
+                pool.Add(name, threshold);
+            });
+
+    Player reused("Seat1", threshold);
+    Measure("reused Player round", rounds, [&](uint64_t op)
+            {
+                if (deck.CardsInDeck() < 12)
+                    deck.Reset(3u, op);
+                reused.EmptyHand();
+                while (reused.Score() < threshold)
+                    reused.AddCard(deck.Deal());
+            });
+
+    // As game.cpp plays a round: new players and a new deck every time
+    Measure("PlayBlackJack, new", rounds, [&](uint64_t op)
+            {
+                vector<Player> players;
+                for (int i = 0; i < seats; i++)
+                    players.push_back(Player("Seat" + to_string(i + 1), threshold));
+                Deck fresh = Deck::Seeded(4u, op);
+                PlayBlackJack(players, fresh);
+                SortPlayers(players);
+            });
+
+    vector<Player> players;
+    for (int i = 0; i < seats; i++)
+        players.push_back(Player("Seat" + to_string(i + 1), threshold));
+    Measure("PlayBlackJack, steady", rounds, [&](uint64_t op)
+            {
+                deck.Reset(5u, op);
+                for (Player &player : players)
+                    player.EmptyHand();
+                PlayBlackJack(players, deck);
+                SortPlayers(players);
+            });
+    return 0;
+}
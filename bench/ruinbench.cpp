@@ -0,0 +1,86 @@
+/**
+ * @file ruinbench.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Compares risk of ruin from RuinCalculator's convolution with brute force Monte Carlo
+ *        sessions from BankrollSimulator, both from the same dealt outcome distribution: the
+ *        answers, the Monte Carlo error bar and the time each takes.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <utils.h>
+#include <BankrollSimulator.h>
+#include <RuinCalculator.h>
+
+using namespace std;
+using namespace chants;
+
+// Seconds since start
+double SecondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t paths = argc > 1 && isANumber(argv[1]) ? stoull(argv[1]) : 200000;
+
+    BankrollSimulator simulator = BankrollSimulator::FromTable(DealerRules(), 1, 1000000, 1u);
+    RuinCalculator calculator(simulator.Outcomes(), simulator.Probabilities());
+    cout << "Per hand: mean " << fixed << setprecision(4) << simulator.MeanPerHand() << ", sd "
+         << sqrt(simulator.VariancePerHand()) << ", " << simulator.Outcomes().size() << " outcomes, step "
+         << calculator.Step() << endl;
+    cout << "Monte Carlo: " << paths << " sessions" << endl;
+#ifndef __OPTIMIZE__
+    cout << "Unoptimized build, configure with -DCMAKE_BUILD_TYPE=Release for representative times" << endl;
+#endif
+    cout << setw(10) << right << "Bankroll" << setw(8) << "Hours" << setw(16) << "Exact ruin" << setw(10) << "ms"
+         << setw(16) << "MC ruin" << setw(14) << "+/- 95%" << setw(10) << "ms" << endl;
+
+    const int bankrolls[] = {10, 25, 50, 100};
+    const int hours[] = {1, 10, 100};
+    uint64_t slowestHands = 0;
+    double slowestExactMs = 0;
+    double slowestMonteCarloMs = 0;
+    for (int bankroll : bankrolls)
+    {
+        for (int hour : hours)
+        {
+            SessionConfig config;
+            config.paths = paths;
+            config.hours = hour;
+            config.bankroll = bankroll;
+
+            auto start = chrono::steady_clock::now();
+            SessionDistribution exact = calculator.Session(bankroll, static_cast<uint64_t>(hour) * config.handsPerHour,
+                                                           simulator.Floor());
+            double exactMs = 1000 * SecondsSince(start);
+
+            start = chrono::steady_clock::now();
+            SessionReport report = simulator.Run(config);
+            double monteCarloMs = 1000 * SecondsSince(start);
+            double error = 1.96 * sqrt(report.ruin * (1 - report.ruin) / paths);
+            if (exactMs > slowestExactMs)
+            {
+                slowestHands = static_cast<uint64_t>(hour) * config.handsPerHour;
+                slowestExactMs = exactMs;
+                slowestMonteCarloMs = monteCarloMs;
+            }
+
+            cout << setw(10) << bankroll << setw(8) << hour << scientific << setprecision(4)
+                 << setw(16) << exact.Ruin() << fixed << setprecision(2) << setw(10) << exactMs
+                 << scientific << setprecision(4) << setw(16) << report.ruin << setw(14) << error
+                 << fixed << setprecision(2) << setw(10) << monteCarloMs << endl;
+        }
+    }
+
+    // The slowest exact session, the figure to quote for the calculator
+    cout << "Slowest exact session: " << slowestHands << " hands in " << fixed << setprecision(1) << slowestExactMs
+         << " ms, Monte Carlo " << slowestMonteCarloMs << " ms" << endl;
+    return 0;
+}
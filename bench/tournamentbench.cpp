@@ -0,0 +1,75 @@
+/**
+ * @file tournamentbench.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Times a whole elimination Tournament of a million entrants, from making the players to
+ *        the final table, on one thread and on every core.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <utils.h>
+#include <Tournament.h>
+
+using namespace std;
+using namespace chants;
+
+// Seconds since start
+double SecondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Run one bracket and print its rounds
+void RunBracket(const TournamentConfig &config)
+{
+    auto start = chrono::steady_clock::now();
+    Tournament tournament(config);
+    double setupSeconds = SecondsSince(start);
+    start = chrono::steady_clock::now();
+    tournament.Run();
+    double playSeconds = SecondsSince(start);
+
+    uint64_t seated = 0;
+    cout << "Threads: " << config.threads << ", entrants made in " << fixed << setprecision(3) << setupSeconds << " s" << endl;
+    cout << setw(8) << right << "Round" << setw(12) << "Players" << setw(10) << "Tables" << setw(10) << "Redeals"
+         << setw(12) << "Survivors" << setw(10) << "ms" << endl;
+    for (size_t i = 0; i < tournament.Rounds().size(); i++)
+    {
+        const TournamentRound &round = tournament.Rounds()[i];
+        seated += round.players;
+        cout << setw(8) << i + 1 << setw(12) << round.players << setw(10) << round.tables << setw(10) << round.redeals
+             << setw(12) << round.survivors << setw(10) << setprecision(2) << 1000 * round.seconds << endl;
+    }
+    cout << "Bracket played in " << setprecision(3) << playSeconds << " s, " << setprecision(0)
+         << seated / playSeconds << " seats/s, champion";
+    for (uint32_t champion : tournament.Survivors())
+    {
+        PooledPlayer &player = tournament.Entrant(champion);
+        cout << " " << player.GetName().str() << " (threshold " << player.GetThreshold() << ")";
+    }
+    cout << "\n\n";
+}
+
+int main(int argc, char **argv)
+{
+    TournamentConfig config;
+    config.entrants = argc > 1 && isANumber(argv[1]) ? stoull(argv[1]) : 1000000;
+    config.seatsPerTable = argc > 2 && isANumber(argv[2]) ? stoi(argv[2]) : 6;
+    config.thresholds = {13, 14, 15, 16, 17, 18, 19};
+    config.seed = 7;
+
+    config.threads = 1;
+    RunBracket(config);
+    int cores = max(1, static_cast<int>(thread::hardware_concurrency()));
+    if (cores > 1)
+    {
+        config.threads = cores;
+        RunBracket(config);
+    }
+    return 0;
+}
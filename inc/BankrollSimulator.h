@@ -0,0 +1,168 @@
+/**
+ * @file BankrollSimulator.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the BankrollSimulator class, which follows many sessions' bankrolls at
+ *        once to report hourly win, its variance, drawdowns and risk of ruin.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <DealerTable.h>
+#include <Statistics.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief What a run of sessions looks like
+     */
+    struct SessionConfig
+    {
+        /// @brief Independent sessions to follow
+        uint64_t paths = 100000;
+        /// @brief Hours in a session
+        int hours = 4;
+        /// @brief Hands played per hour
+        int handsPerHour = 100;
+        /// @brief Bankroll at the start of a session, in bet units
+        double bankroll = 100;
+        /// @brief Seed of the sessions
+        uint64_t seed = 1;
+    };
+
+    /**
+     * @brief Results of a run of sessions, all amounts in bet units
+     */
+    struct SessionReport
+    {
+        /// @brief Sessions followed
+        uint64_t paths = 0;
+        /// @brief Hands played, ruined sessions stop playing
+        uint64_t hands = 0;
+        /// @brief Win of every session hour
+        RunningStats hourly;
+        /// @brief Bankroll at the end of every session
+        RunningStats final;
+        /// @brief Share of sessions that went broke, left unable to cover the worst loss of a hand
+        double ruin = 0;
+        /// @brief Largest fall from a high of each session, sorted
+        vector<double> drawdowns;
+
+        /**
+         * @brief Get the drawdown a share of the sessions stayed within
+         *
+         * @param share - 0 - 1, for example 0.99
+         * @return double
+         */
+        double DrawdownPercentile(double share) const;
+    };
+
+    /**
+     * @brief BankrollSimulator plays sessions by drawing each hand's result from the outcome
+     *        distribution of a table, with Walker's alias method so one draw is one random
+     *        number, one table lookup and one compare. Sessions are advanced in blocks whose
+     *        bankroll, high, drawdown and generator state sit in separate arrays, so each hand
+     *        is one plain loop over the block that the compiler can vectorize, and blocks are
+     *        spread over threads. Every session has its own generator, so a run gives the same
+     *        report on any number of threads.
+     *
+     *        Hands are taken as independent, which ignores what the cards left in a shoe say
+     *        about the next hands; the per hand mean and variance come from real dealt rounds.
+     */
+    class BankrollSimulator
+    {
+    private:
+        /// @brief Distinct results of one hand, in bet units
+        vector<double> _outcomes;
+        /// @brief Probability of each outcome
+        vector<double> _probabilities;
+        /// @brief Alias method threshold of each outcome, out of 2^32
+        vector<uint32_t> _keep;
+        /// @brief Alias method replacement of each outcome
+        vector<double> _alias;
+        /// @brief Mean of one hand
+        double _mean;
+        /// @brief Variance of one hand
+        double _variance;
+        /// @brief Smallest bankroll that plays a hand, the worst loss of one hand
+        double _floor;
+
+    public:
+        /// @brief Sessions advanced together, one SoA block
+        static const int BlockPaths = 1024;
+
+        /**
+         * @brief Construct a BankrollSimulator from the results of one hand and their weights
+         *
+         * @param outcomes - result of one hand in bet units
+         * @param weights - how often each outcome happens, need not add up to 1
+         * @throws runtime_error if the lists differ in size, are empty, or weigh nothing
+         */
+        BankrollSimulator(const vector<double> &outcomes, const vector<double> &weights);
+
+        /**
+         * @brief Measure the outcome distribution of a DealerTable and build a simulator from it
+         *
+         * @param rules - rules of the table
+         * @param seats - seats at the table, each betting one unit
+         * @param rounds - rounds to deal
+         * @param seed
+         * @return BankrollSimulator
+         */
+        static BankrollSimulator FromTable(const DealerRules &rules, int seats, uint64_t rounds, uint64_t seed);
+
+        /**
+         * @brief Get the expected result of one hand
+         *
+         * @return double
+         */
+        double MeanPerHand() const;
+
+        /**
+         * @brief Get the variance of one hand
+         *
+         * @return double
+         */
+        double VariancePerHand() const;
+
+        /**
+         * @brief Get the smallest bankroll that still plays a hand: the worst loss a hand can
+         *        have, doubles and splits included, and at least a unit bet. Pass it to
+         *        RuinCalculator::Session as the floor to compute the same ruin exactly.
+         *
+         * @return double
+         */
+        double Floor() const;
+
+        /**
+         * @brief Get the distinct outcomes of one hand
+         *
+         * @return const vector<double>&
+         */
+        const vector<double> &Outcomes() const;
+
+        /**
+         * @brief Get the probability of each outcome
+         *
+         * @return const vector<double>&
+         */
+        const vector<double> &Probabilities() const;
+
+        /**
+         * @brief Play the sessions. A session that cannot cover the worst loss of a hand, at
+         *        least a unit bet, stops playing and counts as ruined.
+         *
+         * @param config
+         * @param threads - 0 for one per core
+         * @return SessionReport
+         */
+        SessionReport Run(const SessionConfig &config, int threads = 0) const;
+    };
+}
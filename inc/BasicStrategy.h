@@ -0,0 +1,170 @@
+/**
+ * @file BasicStrategy.h
+ * @brief Basic strategy for 6 decks, dealer stands on soft 17, double after split allowed.
+ *        Generated by strategygen from StrategySolver, do not edit by hand.
+ *        The solver draws every card after the upcard from one fixed shoe composition, not
+ *        removing the player's cards, so a few close plays such as soft 13 against a 5
+ *        can differ from published tables for the same rules.
+ * @version 1.0
+ *
+ *
+ */
+#pragma once
+
+#include <StrategyAction.h>
+
+namespace chants
+{
+    namespace BasicStrategy
+    {
+        /// @brief Rules the tables were solved for
+        constexpr int Decks = 6;
+        constexpr bool DealerHitsSoft17 = false;
+        constexpr bool DoubleAfterSplit = true;
+
+        constexpr StrategyAction S = StrategyStand, H = StrategyHit, D = StrategyDouble;
+        constexpr bool Y = true, N = false;
+
+        /// @brief Hard totals on the first two cards, [total][upcard - 2]
+        constexpr StrategyAction Hard[22][10] = {
+            //      2  3  4  5  6  7  8  9  T  A
+            /*  0 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  1 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  2 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  3 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  4 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  5 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  6 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  7 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  8 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  9 */ {H, D, D, D, D, H, H, H, H, H},
+            /* 10 */ {D, D, D, D, D, D, D, D, H, H},
+            /* 11 */ {D, D, D, D, D, D, D, D, D, H},
+            /* 12 */ {H, H, S, S, S, H, H, H, H, H},
+            /* 13 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 14 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 15 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 16 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 17 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 18 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 19 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 20 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 21 */ {S, S, S, S, S, S, S, S, S, S}
+        };
+
+        /// @brief Soft totals on the first two cards, [total][upcard - 2]
+        constexpr StrategyAction Soft[22][10] = {
+            //      2  3  4  5  6  7  8  9  T  A
+            /*  0 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  1 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  2 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  3 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  4 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  5 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  6 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  7 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  8 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  9 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 10 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 11 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 12 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 13 */ {H, H, H, H, D, H, H, H, H, H},
+            /* 14 */ {H, H, H, D, D, H, H, H, H, H},
+            /* 15 */ {H, H, D, D, D, H, H, H, H, H},
+            /* 16 */ {H, H, D, D, D, H, H, H, H, H},
+            /* 17 */ {H, D, D, D, D, H, H, H, H, H},
+            /* 18 */ {S, D, D, D, D, S, S, H, H, H},
+            /* 19 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 20 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 21 */ {S, S, S, S, S, S, S, S, S, S}
+        };
+
+        /// @brief Hard totals after a hit, [total][upcard - 2]
+        constexpr StrategyAction HardNoDouble[22][10] = {
+            //      2  3  4  5  6  7  8  9  T  A
+            /*  0 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  1 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  2 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  3 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  4 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  5 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  6 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  7 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  8 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  9 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 10 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 11 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 12 */ {H, H, S, S, S, H, H, H, H, H},
+            /* 13 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 14 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 15 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 16 */ {S, S, S, S, S, H, H, H, H, H},
+            /* 17 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 18 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 19 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 20 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 21 */ {S, S, S, S, S, S, S, S, S, S}
+        };
+
+        /// @brief Soft totals after a hit, [total][upcard - 2]
+        constexpr StrategyAction SoftNoDouble[22][10] = {
+            //      2  3  4  5  6  7  8  9  T  A
+            /*  0 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  1 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  2 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  3 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  4 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  5 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  6 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  7 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  8 */ {H, H, H, H, H, H, H, H, H, H},
+            /*  9 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 10 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 11 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 12 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 13 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 14 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 15 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 16 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 17 */ {H, H, H, H, H, H, H, H, H, H},
+            /* 18 */ {S, S, S, S, S, S, S, H, H, H},
+            /* 19 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 20 */ {S, S, S, S, S, S, S, S, S, S},
+            /* 21 */ {S, S, S, S, S, S, S, S, S, S}
+        };
+
+        /// @brief Whether to split a pair, [pair card points][upcard - 2]
+        constexpr bool Split[12][10] = {
+            //      2  3  4  5  6  7  8  9  T  A
+            /*  0 */ {N, N, N, N, N, N, N, N, N, N},
+            /*  1 */ {N, N, N, N, N, N, N, N, N, N},
+            /*  2 */ {Y, Y, Y, Y, Y, Y, N, N, N, N},
+            /*  3 */ {Y, Y, Y, Y, Y, Y, N, N, N, N},
+            /*  4 */ {N, N, N, Y, Y, N, N, N, N, N},
+            /*  5 */ {N, N, N, N, N, N, N, N, N, N},
+            /*  6 */ {Y, Y, Y, Y, Y, N, N, N, N, N},
+            /*  7 */ {Y, Y, Y, Y, Y, Y, N, N, N, N},
+            /*  8 */ {Y, Y, Y, Y, Y, Y, Y, Y, Y, Y},
+            /*  9 */ {Y, Y, Y, Y, Y, N, Y, Y, N, N},
+            /* 10 */ {N, N, N, N, N, N, N, N, N, N},
+            /* 11 */ {Y, Y, Y, Y, Y, Y, Y, Y, Y, Y}
+        };
+    }
+
+    /**
+     * @brief Look up the basic strategy decision for a hand
+     *
+     * @param total - player total 4 - 21
+     * @param soft - true when an Ace counts as 11
+     * @param upcard - dealer upcard points 2 - 11
+     * @param canDouble - true on the first two cards
+     * @param pair - true when the first two cards have the same points
+     * @return StrategyAction
+     */
+    constexpr StrategyAction BasicStrategyAction(int total, bool soft, int upcard, bool canDouble, bool pair = false)
+    {
+        return pair && BasicStrategy::Split[soft ? 11 : total / 2][upcard - 2] ? StrategySplit
+               : canDouble ? (soft ? BasicStrategy::Soft : BasicStrategy::Hard)[total][upcard - 2]
+                           : (soft ? BasicStrategy::SoftNoDouble : BasicStrategy::HardNoDouble)[total][upcard - 2];
+    }
+}
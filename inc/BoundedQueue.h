@@ -0,0 +1,162 @@
+/**
+ * @file BoundedQueue.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header only, fixed capacity, lock-free multi-producer multi-consumer queue used between pipeline stages.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace chants
+{
+
+    /**
+     * @brief BoundedQueue is Dmitry Vyukov's bounded MPMC queue. Every cell carries a sequence
+     *        number that tells producers and consumers whose turn it is, so a push or pop is one
+     *        compare-and-swap on the shared position and never takes a lock. The capacity is
+     *        rounded up to a power of two and never changes, so a full queue pushes back on producers.
+     *
+     * @tparam T - trivially copyable item type
+     */
+    template <typename T>
+    class BoundedQueue
+    {
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        /// @brief The ring of cells
+        std::unique_ptr<Cell[]> _buffer;
+        /// @brief Capacity - 1, used to wrap positions
+        size_t _mask;
+        /// @brief Next position to push, on its own cache line
+        alignas(64) std::atomic<size_t> _enqueuePos;
+        /// @brief Next position to pop, on its own cache line
+        alignas(64) std::atomic<size_t> _dequeuePos;
+
+    public:
+        /**
+         * @brief Construct a new BoundedQueue
+         *
+         * @param capacity - minimum number of items, rounded up to a power of two
+         */
+        explicit BoundedQueue(size_t capacity)
+        {
+            size_t size = 2;
+            while (size < capacity)
+                size <<= 1;
+
+            _buffer.reset(new Cell[size]);
+            _mask = size - 1;
+            for (size_t i = 0; i < size; i++)
+            {
+                _buffer[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            _enqueuePos.store(0, std::memory_order_relaxed);
+            _dequeuePos.store(0, std::memory_order_relaxed);
+        }
+
+        BoundedQueue(const BoundedQueue &) = delete;
+        BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+        /**
+         * @brief Push an item if there is room
+         *
+         * @param item
+         * @return true if the item was pushed, false if the queue is full
+         */
+        bool TryPush(const T &item)
+        {
+            size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell &cell = _buffer[pos & _mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.data = item;
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Pop an item if there is one
+         *
+         * @param item - receives the popped item
+         * @return true if an item was popped, false if the queue is empty
+         */
+        bool TryPop(T &item)
+        {
+            size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell &cell = _buffer[pos & _mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        item = cell.data;
+                        cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Get the number of cells in the ring
+         *
+         * @return size_t
+         */
+        size_t Capacity() const
+        {
+            return _mask + 1;
+        }
+
+        /**
+         * @brief Get an approximate item count, exact only when no other thread is using the queue
+         *
+         * @return size_t
+         */
+        size_t ApproxSize() const
+        {
+            size_t head = _dequeuePos.load(std::memory_order_relaxed);
+            size_t tail = _enqueuePos.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+    };
+}
@@ -22,37 +22,37 @@ namespace chants
         ///         The value is set in the parameterized constructor
         int _value;
 
-        /// @brief _strValue is the text representation for values 1 - 13
+        /// @brief _rank is the integer 1 - 13 the card was made with
         ///         where 1 is Ace, 11 is Jack, 12 is Queen, and 13 is King
-        string _strValue;
+        int _rank;
 
         /// @brief _suit will be an integer between 1 and 4
         ///         where 1 = Clubs, 2 = Diamonds, 3 = Hearts, and 4 is Spades
         int _suit;
 
-        /// @brief _strSuit will be the text Clubs, Diamonds, Hearts, or Spades
-        string _strSuit;
-
         /**
          * @brief converts the card integer to a string representation,
          *          example: 1 = Ace, 11 = Jack, 12 = Queen, 13 = King.
-         *          It is a private method called in the parameterized constructor
+         *          It is a private method called by ToString, so making and copying a
+         *          card never builds a string
          *
          * @param val - number 1 - 13
+         * @return string
          */
-        void convertValueToString(int val);
+        static string convertValueToString(int val);
 
         /**
          * @brief converts the suit integer to a string representation,
          *          example: 1 = Clubs, 2 = Diamonds, 3 = Hearts, 4 = Spades.
-         *          It is a private method called in the parameterized constructor
+         *          It is a private method called by ToString
          *
          * @param val - number 1 - 4
+         * @return string
          */
-        void convertSuitToString(int suit);
+        static string convertSuitToString(int suit);
 
     public:
-        /// @brief When isFaceUp is true, the ToString function will display the card _strValue and _strSuit
+        /// @brief When isFaceUp is true, the ToString function will display the card rank and suit
         ///     When isFaceUp is false, the ToString function will display "Face-down"
         bool isFaceUp;
 
@@ -73,6 +73,22 @@ namespace chants
          */
         int GetValue();
 
+        /**
+         * @brief Get the rank the card was made with, 1 - 13
+         *      where 1 is Ace, 11 is Jack, 12 is Queen, 13 is King
+         *
+         * @return int
+         */
+        int GetRank() const;
+
+        /**
+         * @brief Get the suit of the card, 1 - 4
+         *      where 1 is Clubs, 2 is Diamonds, 3 is Hearts, 4 is Spades
+         *
+         * @return int
+         */
+        int GetSuit() const;
+
         /**
          * @brief Simple string output that represents this playing card face up or face-down
          *
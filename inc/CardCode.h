@@ -0,0 +1,79 @@
+/**
+ * @file CardCode.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Compact one-byte card codes used by the simulation kernels. A code is the
+ *        position of the card in an unshuffled Deck: (suit - 1) * 13 + (value - 1).
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chants
+{
+    /// @brief Number of cards in one standard deck
+    const int CardsPerDeck = 52;
+
+    /**
+     * @brief Build the code for a card
+     *
+     * @param value - number 1 - 13, Ace - King
+     * @param suit - number 1 - 4, Clubs, Diamonds, Hearts, Spades
+     * @return uint8_t code between 0 and 51
+     */
+    constexpr uint8_t MakeCardCode(int value, int suit)
+    {
+        return static_cast<uint8_t>((suit - 1) * 13 + (value - 1));
+    }
+
+    /**
+     * @brief Get the value 1 - 13 (Ace - King) of a card code
+     *
+     * @param code
+     * @return int
+     */
+    constexpr int CodeToValue(uint8_t code)
+    {
+        return code % 13 + 1;
+    }
+
+    /**
+     * @brief Get the suit 1 - 4 (Clubs - Spades) of a card code
+     *
+     * @param code
+     * @return int
+     */
+    constexpr int CodeToSuit(uint8_t code)
+    {
+        return code / 13 + 1;
+    }
+
+    /**
+     * @brief Get the points of a card code the same way Card::GetValue does,
+     *        where Ace is 11 and Jack, Queen and King are 10
+     *
+     * @param code
+     * @return int
+     */
+    constexpr int CodeToPoints(uint8_t code)
+    {
+        return CodeToValue(code) == 1 ? 11 : (CodeToValue(code) > 10 ? 10 : CodeToValue(code));
+    }
+
+    /**
+     * @brief Score a hand the way Player does: Aces count 11 unless that puts the hand over 21,
+     *        and then every Ace counts 1. Every threshold round kernel scores with this rule so
+     *        it matches PlayBlackJack.
+     *
+     * @param points - points of the hand with every Ace counted as 11
+     * @param aces - number of Aces in the hand
+     * @return int
+     */
+    constexpr int HandScore(int points, int aces)
+    {
+        return points > 21 ? points - 10 * aces : points;
+    }
+}
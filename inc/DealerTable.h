@@ -0,0 +1,196 @@
+/**
+ * @file DealerTable.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the DealerTable class, casino blackjack against a dealer with bets,
+ *        blackjack payouts and a bankroll for every seat.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <CardCode.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief Rules of a DealerTable
+     */
+    struct DealerRules
+    {
+        /// @brief Decks in the shoe
+        int decks = 6;
+        /// @brief True when the dealer hits soft 17
+        bool dealerHitsSoft17 = false;
+        /// @brief Win on a blackjack per unit bet, 1.5 for 3:2 and 1.2 for 6:5
+        double blackjackPays = 1.5;
+        /// @brief True when a split hand may be doubled
+        bool doubleAfterSplit = true;
+        /// @brief Share of the shoe dealt before the reshuffle
+        double penetration = 0.75;
+    };
+
+    /**
+     * @brief DealerTable deals rounds from a shoe to seats that play basic strategy (see
+     *        BasicStrategy.h) against a dealer who peeks for blackjack. A pair may be split once,
+     *        split Aces get one card each, and a seat only doubles or splits when its bankroll
+     *        covers the extra bet. Bets are settled into each seat's bankroll.
+     */
+    class DealerTable
+    {
+    public:
+        /**
+         * @brief One hand of a seat, two after a split
+         */
+        struct Hand
+        {
+            /// @brief Points with soft Aces as 11
+            int total;
+            /// @brief Aces still counted as 11
+            int softAces;
+            /// @brief Cards in the hand
+            int cards;
+            /// @brief Points of the first card, to spot pairs
+            int firstPoints;
+            /// @brief Amount at stake
+            double bet;
+            /// @brief True for a hand made by splitting
+            bool fromSplit;
+        };
+
+    private:
+        /// @brief Rules of the table
+        DealerRules _rules;
+        /// @brief Seed of the shuffles
+        uint64_t _seed;
+        /// @brief True when the shoe was given and is never reshuffled
+        bool _stacked;
+        /// @brief Card codes of the shoe
+        vector<uint8_t> _shoe;
+        /// @brief Next card of the shoe
+        int _next;
+        /// @brief Shoes shuffled so far
+        uint64_t _shoes;
+        /// @brief Rounds played
+        uint64_t _rounds;
+        /// @brief Bankroll of each seat
+        vector<double> _bankrolls;
+        /// @brief Result of each seat's last round
+        vector<double> _net;
+        /// @brief Hands of the round, two per seat
+        vector<Hand> _hands;
+        /// @brief Hands each seat played last round, 0 when it sat out
+        vector<int> _handCounts;
+
+        /**
+         * @brief Deal the next card of the shoe
+         *
+         * @return uint8_t - card code
+         * @throws runtime_error when the shoe is empty
+         */
+        uint8_t deal();
+
+        /**
+         * @brief Reshuffle when the shoe is past the cut card, or could not finish a round
+         *
+         */
+        void shuffleIfNeeded();
+
+        /**
+         * @brief Play one hand by basic strategy
+         *
+         * @param seat
+         * @param hand - index in _hands
+         * @param upcard - points of the dealer's upcard
+         */
+        void playHand(int seat, int hand, int upcard);
+
+    public:
+        /**
+         * @brief Construct a DealerTable that shuffles its shoes from a seed
+         *
+         * @param rules
+         * @param seed
+         * @throws runtime_error for rules without room for a round
+         */
+        DealerTable(const DealerRules &rules, uint64_t seed);
+
+        /**
+         * @brief Construct a DealerTable that deals a stacked shoe once, in order
+         *
+         * @param rules
+         * @param cards - card codes
+         * @param count
+         */
+        DealerTable(const DealerRules &rules, const uint8_t *cards, int count);
+
+        /**
+         * @brief Seat a player
+         *
+         * @param bankroll - money to start with
+         * @return int - seat index
+         */
+        int Join(double bankroll);
+
+        /**
+         * @brief Get the number of seats
+         *
+         * @return int
+         */
+        int Seats() const;
+
+        /**
+         * @brief Play a round. A seat sits out when its bet is not positive or is more than
+         *        its bankroll.
+         *
+         * @param bets - bet of each seat
+         * @return uint64_t - index of the round
+         * @throws runtime_error if the shoe runs out
+         */
+        uint64_t PlayRound(const double *bets);
+
+        /**
+         * @brief Get a seat's bankroll
+         *
+         * @param seat
+         * @return double
+         */
+        double Bankroll(int seat) const;
+
+        /**
+         * @brief Get what a seat won or lost in the last round
+         *
+         * @param seat
+         * @return double
+         */
+        double Net(int seat) const;
+
+        /**
+         * @brief Get the number of hands a seat played in the last round
+         *
+         * @param seat
+         * @return int - 0 when the seat sat out, 2 after a split
+         */
+        int HandsPlayed(int seat) const;
+
+        /**
+         * @brief Get the number of shoes shuffled
+         *
+         * @return uint64_t
+         */
+        uint64_t Shoes() const;
+
+        /**
+         * @brief Get the rules
+         *
+         * @return const DealerRules&
+         */
+        const DealerRules &Rules() const;
+    };
+}
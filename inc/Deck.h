@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <Card.h>
@@ -28,15 +30,25 @@ namespace chants
         /// @brief Vector to hold the collection of Card objects in the deck.
         vector<Card> deck;
 
+        /// @brief Index of the next card to deal, the cards before it have been dealt.
+        int _top;
+
         /**
          * @brief Initializes and builds the standard deck of cards.
          */
         void buildDeck();
 
         /**
-         * @brief Randomly shuffles the deck of cards to ensure randomized order.
+         * @brief Shuffles the deck with the Philox stream of (seed, round), so the order can be regenerated.
+         * @param seed Seed of the run.
+         * @param round Index of the round.
+         */
+        void shuffleDeck(uint64_t seed, uint64_t round);
+
+        /**
+         * @brief Construct an empty Deck, filled by the Seeded and FromCodes factories.
          */
-        void shuffleDeck();
+        Deck();
 
     public:
         /**
@@ -45,12 +57,46 @@ namespace chants
          */
         Deck(bool shuffle);
 
+        /**
+         * @brief Create a Deck shuffled for one round of a seeded run.
+         *        The same seed and round always give the same order, whatever rounds came before.
+         * @param seed Seed of the run.
+         * @param round Index of the round.
+         * @return Deck in the order of ShuffleKernel::ShuffleRound(seed, round).
+         */
+        static Deck Seeded(uint64_t seed, uint64_t round);
+
+        /**
+         * @brief Create a Deck from card codes, for example one shoe produced by
+         *        ShuffleKernel::ShuffleBatch. The first code is the first card dealt.
+         * @param cards Card codes, see CardCode.h.
+         * @param count Number of codes to copy into the deck.
+         * @return Deck holding the codes in order.
+         */
+        static Deck FromCodes(const uint8_t *cards, int count);
+
+        /**
+         * @brief Rebuilds and reshuffles the deck in place for another round of a seeded run,
+         *        giving the same order as Deck::Seeded(seed, round) without allocating.
+         * @param seed Seed of the run.
+         * @param round Index of the round.
+         */
+        void Reset(uint64_t seed, uint64_t round);
+
         /**
          * @brief Deals a card from the top of the deck.
          * @return Card object representing the dealt card.
          */
         Card Deal();
 
+        /**
+         * @brief Looks at a card still in the deck without dealing it.
+         * @param offset Position from the top, 0 is the next card dealt.
+         * @return Card at that position.
+         * @throws out_of_range if fewer than offset + 1 cards are left.
+         */
+        Card CardAt(int offset) const;
+
         /**
          * @brief Provides a string representation of the entire deck.
          * @return string representing the deck's current state.
@@ -0,0 +1,134 @@
+/**
+ * @file GameServer.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the GameServer class, which hosts many game tables over a loopback TCP
+ *        or Unix domain socket with one epoll event loop per thread.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief Settings of a GameServer
+     */
+    struct ServerConfig
+    {
+        /// @brief Path of a Unix domain socket to listen on, empty to listen on loopback TCP
+        string unixPath;
+        /// @brief Loopback TCP port, 0 picks a free port
+        int port = 7777;
+        /// @brief Number of event loop threads, 0 for one per core
+        int threads = 0;
+    };
+
+    /**
+     * @brief Counters of a GameServer, summed over its event loops
+     */
+    struct ServerStats
+    {
+        /// @brief Connections accepted
+        uint64_t connections = 0;
+        /// @brief Tables opened
+        uint64_t tables = 0;
+        /// @brief Rounds played
+        uint64_t rounds = 0;
+        /// @brief Request lines handled
+        uint64_t requests = 0;
+    };
+
+    /**
+     * @brief GameServer runs one epoll event loop per thread. All loops wait on the same
+     *        non-blocking listening socket with EPOLLEXCLUSIVE, so each new connection wakes one
+     *        loop and stays on it. A connection owns its tables, so a table is only touched by
+     *        its loop and nothing is locked.
+     *
+     *        The protocol is one request line, one reply line:
+     *        - OPEN seats threshold: opens a table with seats players named Seat1.. -> OK table
+     *        - JOIN table name threshold: seats another player -> OK
+     *        - PLAY table: plays a round -> RESULT round name score W|B|- ...
+     *        - CLOSE table: closes a table -> OK
+     *        - QUIT: closes the connection once the replies before it are sent
+     *        A request that can not be served gets ERR and a message.
+     */
+    class GameServer
+    {
+    private:
+        /// @brief Settings
+        ServerConfig _config;
+        /// @brief The listening socket
+        int _listenFd;
+        /// @brief Bound TCP port, 0 for a Unix socket
+        uint16_t _port;
+        /// @brief One eventfd per loop, written by Stop to wake the loop
+        vector<int> _wakeFds;
+        /// @brief Set by Stop
+        std::atomic<bool> _stopping;
+        /// @brief Counters of each loop, summed when Run returns
+        vector<ServerStats> _loopStats;
+        /// @brief Counters of the last Run
+        ServerStats _stats;
+
+        /**
+         * @brief Run the event loop of one thread until Stop
+         *
+         * @param index - index of the loop
+         */
+        void runLoop(int index);
+
+    public:
+        /**
+         * @brief Create the listening socket
+         *
+         * @param config
+         * @throws runtime_error if the socket can not be created, bound or listened on
+         */
+        explicit GameServer(const ServerConfig &config);
+
+        GameServer(const GameServer &) = delete;
+        GameServer &operator=(const GameServer &) = delete;
+
+        /**
+         * @brief Close the listening socket, and remove the Unix socket file
+         *
+         */
+        ~GameServer();
+
+        /**
+         * @brief Get the bound TCP port
+         *
+         * @return uint16_t - 0 when listening on a Unix socket
+         */
+        uint16_t Port() const;
+
+        /**
+         * @brief Run every event loop, the calling thread runs the first one. Returns after Stop.
+         *
+         */
+        void Run();
+
+        /**
+         * @brief Ask every event loop to finish, safe to call from any thread or a signal handler
+         *
+         */
+        void Stop();
+
+        /**
+         * @brief Get the counters of the last Run
+         *
+         * @return ServerStats
+         */
+        ServerStats Stats() const;
+    };
+}
@@ -0,0 +1,210 @@
+/**
+ * @file HandHistory.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the binary hand history log. A log is a 16 byte header followed by
+ *        fixed size 32 byte records, one per seat per round, in the byte order of the machine.
+ *        HandHistoryWriter appends records through a large buffer and HandHistoryReader
+ *        memory-maps a log and reads the records in place, without parsing.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <Round.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief How a seat finished a round
+     */
+    enum HandOutcome : uint8_t
+    {
+        HandLost = 0,
+        HandBusted = 1,
+        HandWon = 2
+    };
+
+    /**
+     * @brief The first bytes of every log
+     */
+    struct HandHistoryHeader
+    {
+        /// @brief Always "BJHH"
+        char magic[4];
+        /// @brief Format version, currently 1
+        uint32_t version;
+        /// @brief sizeof(HandRecord), so a reader can reject a log of another layout
+        uint32_t recordSize;
+        /// @brief Zero, kept for later use
+        uint32_t reserved;
+    };
+
+    /**
+     * @brief One seat of one round
+     */
+    struct HandRecord
+    {
+        /// @brief Number of cards kept in cards, more cards than this are counted but not kept
+        static const int MaxCards = 18;
+
+        /// @brief Index of the round
+        uint64_t round;
+        /// @brief Seat of the player, 0 is the first seat dealt
+        uint16_t seat;
+        /// @brief Threshold the seat played with
+        uint8_t threshold;
+        /// @brief Final score
+        uint8_t score;
+        /// @brief A HandOutcome
+        uint8_t outcome;
+        /// @brief Number of cards dealt to the seat
+        uint8_t cardCount;
+        /// @brief Card codes of the hand in the order dealt, see CardCode.h
+        uint8_t cards[MaxCards];
+    };
+
+    static_assert(sizeof(HandHistoryHeader) == 16, "HandHistoryHeader must stay 16 bytes");
+    static_assert(sizeof(HandRecord) == 32, "HandRecord must stay 32 bytes");
+
+    /**
+     * @brief HandHistoryWriter appends records to a log, creating it if needed.
+     *        Records are collected in memory and written in large blocks.
+     */
+    class HandHistoryWriter
+    {
+    private:
+        /// @brief The open log
+        FILE *_file;
+        /// @brief Records not written yet
+        vector<HandRecord> _buffer;
+        /// @brief Number of records in the buffer
+        size_t _used;
+        /// @brief Records written by this writer, including the buffered ones
+        uint64_t _records;
+
+    public:
+        /**
+         * @brief Open a log for appending, cutting off a last record left torn by a crash
+         *
+         * @param path - path of the log
+         * @param bufferRecords - number of records written per block
+         * @throws runtime_error if the file can not be opened or is not a log of this format,
+         *         or if writing the header fails
+         */
+        HandHistoryWriter(const string &path, size_t bufferRecords = 32768);
+
+        HandHistoryWriter(const HandHistoryWriter &) = delete;
+        HandHistoryWriter &operator=(const HandHistoryWriter &) = delete;
+
+        /**
+         * @brief Flush and close the log
+         *
+         */
+        ~HandHistoryWriter();
+
+        /**
+         * @brief Append one record
+         *
+         * @param record
+         */
+        void Write(const HandRecord &record);
+
+        /**
+         * @brief Append one record per seat of a round played by PlayRound
+         *
+         * @param round - index of the round
+         * @param shoe - the shoe the round was played from
+         * @param thresholds - threshold of each seat
+         * @param results - result of each seat
+         * @param seats - number of seats
+         */
+        void WriteRound(uint64_t round, const uint8_t *shoe, const int *thresholds, const SeatResult *results, int seats);
+
+        /**
+         * @brief Write the buffered records to the file
+         *
+         * @throws runtime_error if the write fails
+         */
+        void Flush();
+
+        /**
+         * @brief Get the number of records appended by this writer
+         *
+         * @return uint64_t
+         */
+        uint64_t Records() const;
+    };
+
+    /**
+     * @brief HandHistoryReader memory-maps a log read-only. The records are used straight
+     *        from the mapping, so opening a log of any size costs the same.
+     */
+    class HandHistoryReader
+    {
+    private:
+        /// @brief Start of the mapping
+        void *_map;
+        /// @brief Size of the mapping in bytes
+        size_t _size;
+        /// @brief First record in the mapping
+        const HandRecord *_records;
+        /// @brief Number of complete records
+        size_t _count;
+
+    public:
+        /**
+         * @brief Map a log
+         *
+         * @param path - path of the log
+         * @throws runtime_error if the file can not be mapped or is not a log of this format
+         */
+        explicit HandHistoryReader(const string &path);
+
+        HandHistoryReader(const HandHistoryReader &) = delete;
+        HandHistoryReader &operator=(const HandHistoryReader &) = delete;
+
+        /**
+         * @brief Unmap the log
+         *
+         */
+        ~HandHistoryReader();
+
+        /**
+         * @brief Get the number of records
+         *
+         * @return size_t
+         */
+        size_t Count() const;
+
+        /**
+         * @brief Get a record
+         *
+         * @param index - 0 to Count() - 1
+         * @return const HandRecord&
+         */
+        const HandRecord &operator[](size_t index) const;
+
+        /**
+         * @brief Get the first record, for range based for loops
+         *
+         * @return const HandRecord*
+         */
+        const HandRecord *begin() const;
+
+        /**
+         * @brief Get one past the last record, for range based for loops
+         *
+         * @return const HandRecord*
+         */
+        const HandRecord *end() const;
+    };
+}
@@ -0,0 +1,64 @@
+/**
+ * @file InfiniteDeck.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the InfiniteDeck class, a card source that draws with replacement so
+ *        it never runs out and dealt cards never change the odds of the next card.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <Card.h>
+#include <Philox.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief InfiniteDeck has the same Deal, ToString and CardsInDeck methods as Deck, so
+     *        PlayBlackJack can play from it. Every card is one of the 52 cards with equal
+     *        probability, drawn from the Philox stream of (seed, round). Nothing is built or shuffled.
+     */
+    class InfiniteDeck
+    {
+    private:
+        /// @brief Random numbers of the round
+        PhiloxStream _stream;
+
+    public:
+        /**
+         * @brief Construct a new InfiniteDeck for one round of a seeded run
+         *
+         * @param seed - seed of the run
+         * @param round - index of the round
+         */
+        InfiniteDeck(uint64_t seed, uint64_t round);
+
+        /**
+         * @brief Deals a random face-down card, the deck is unchanged
+         *
+         * @return Card
+         */
+        Card Deal();
+
+        /**
+         * @brief Provides a string description of the deck
+         *
+         * @return string
+         */
+        string ToString();
+
+        /**
+         * @brief The deck never runs out, so this is always the largest int
+         *
+         * @return int
+         */
+        int CardsInDeck();
+    };
+}
@@ -0,0 +1,116 @@
+/**
+ * @file MonotonicArena.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the MonotonicArena class, a bump allocator that hands out memory from
+ *        large blocks and frees all of it at once.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstddef>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief MonotonicArena allocates by moving a cursor through a block, and takes a new block
+     *        from the heap when one is full. Single allocations are never freed; Release frees
+     *        every block in one step. Memory is not thread safe, each thread needs its own arena.
+     */
+    class MonotonicArena
+    {
+    private:
+        /// @brief Header at the start of each heap block, blocks form a list
+        struct Block
+        {
+            Block *next;
+            size_t size;
+        };
+
+        /// @brief Most recent block
+        Block *_head;
+        /// @brief Next free byte of the current block
+        char *_cursor;
+        /// @brief End of the current block
+        char *_end;
+        /// @brief Size of a normal block
+        size_t _blockBytes;
+        /// @brief Bytes taken from the heap
+        size_t _reserved;
+        /// @brief Bytes handed out
+        size_t _used;
+
+        /**
+         * @brief Take a new block big enough for one allocation
+         *
+         * @param bytes - size of the allocation
+         * @param alignment - alignment of the allocation
+         */
+        void grow(size_t bytes, size_t alignment);
+
+    public:
+        /**
+         * @brief Construct an empty arena, no memory is taken until the first allocation
+         *
+         * @param blockBytes - size of each heap block, larger allocations get their own block
+         */
+        explicit MonotonicArena(size_t blockBytes = 64 * 1024);
+
+        /**
+         * @brief Destroy the arena and free every block
+         *
+         */
+        ~MonotonicArena();
+
+        MonotonicArena(const MonotonicArena &) = delete;
+        MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+        /**
+         * @brief Allocate memory that lives until Release or destruction
+         *
+         * @param bytes - size of the allocation
+         * @param alignment - power of two
+         * @return void* - never null
+         * @throws bad_alloc if the heap is exhausted
+         */
+        void *Allocate(size_t bytes, size_t alignment = alignof(max_align_t));
+
+        /**
+         * @brief Allocate uninitialized room for an array
+         *
+         * @tparam T - element type, trivially destructible since destructors never run
+         * @param count - number of elements
+         * @return T*
+         */
+        template <typename T>
+        T *AllocateArray(size_t count)
+        {
+            return static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        /**
+         * @brief Free every block, every pointer handed out becomes invalid
+         *
+         */
+        void Release();
+
+        /**
+         * @brief Get the bytes handed out since the last Release
+         *
+         * @return size_t
+         */
+        size_t BytesUsed() const;
+
+        /**
+         * @brief Get the bytes taken from the heap since the last Release
+         *
+         * @return size_t
+         */
+        size_t BytesReserved() const;
+    };
+}
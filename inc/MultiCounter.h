@@ -0,0 +1,235 @@
+/**
+ * @file MultiCounter.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the MultiCounter class, which keeps the running count of many card
+ *        counting systems from one stream of dealt cards, and the CountedDeck adapter that feeds
+ *        it every card a deck deals.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Card.h>
+#include <Statistics.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief A card counting system, the tag added to the running count for each rank
+     */
+    struct CountingSystem
+    {
+        /// @brief Name shown in reports
+        string name;
+        /// @brief Tag of each rank 2 - 9, ten and Ace, at index points - 2
+        int tags[10];
+        /// @brief Tags are stored times this, so half point systems stay integers
+        int unit;
+    };
+
+    /**
+     * @brief Get the well known counting systems: Hi-Lo, Hi-Opt I, Hi-Opt II, KO, Omega II, Zen,
+     *        Wong Halves, Uston APC and Ace-Five
+     *
+     * @return vector<CountingSystem>
+     */
+    vector<CountingSystem> StandardCountingSystems();
+
+    /**
+     * @brief How a system sizes its bet from its true count
+     */
+    struct BetRamp
+    {
+        /// @brief Bet at or below a true count of minUnits
+        int minUnits = 1;
+        /// @brief Largest bet
+        int maxUnits = 8;
+    };
+
+    /**
+     * @brief MultiCounter updates every system's running count with one row of a rank by system
+     *        tag matrix per card, a contiguous integer add the compiler vectorizes. Each system
+     *        sizes its own bet from its own true count before a round, and its result per round
+     *        is kept separately, so dozens of systems are compared from one simulation.
+     */
+    class MultiCounter
+    {
+    private:
+        /// @brief Counting systems in column order
+        vector<CountingSystem> _systems;
+        /// @brief Systems rounded up to a whole number of vector lanes
+        size_t _stride;
+        /// @brief Tag matrix, [rank][system] with _stride columns per rank
+        vector<int32_t> _tags;
+        /// @brief Running count of each system, in tag units
+        vector<int32_t> _running;
+        /// @brief Cards in a full shoe
+        int _shoeCards;
+        /// @brief Cards counted since the last shuffle
+        int _seen;
+        /// @brief Bet sizing shared by every system
+        BetRamp _ramp;
+        /// @brief Bet of each system for the round being played
+        vector<int> _bets;
+        /// @brief Units wagered by each system
+        vector<uint64_t> _wagered;
+        /// @brief Win per round of each system, in units
+        vector<RunningStats> _results;
+
+    public:
+        /**
+         * @brief Construct a new MultiCounter
+         *
+         * @param systems - systems to count
+         * @param decks - decks in a full shoe
+         * @param ramp - bet sizing
+         * @throws runtime_error if there are no systems or decks
+         */
+        MultiCounter(const vector<CountingSystem> &systems, int decks, BetRamp ramp = BetRamp());
+
+        /**
+         * @brief Count one dealt card for every system
+         *
+         * @param points - card points 2 - 11, as Card::GetValue
+         */
+        void AddPoints(int points);
+
+        /**
+         * @brief Count one dealt card for every system
+         *
+         * @param card
+         */
+        void AddCard(Card &card);
+
+        /**
+         * @brief Start a new shoe, every count goes back to zero
+         *
+         */
+        void Shuffle();
+
+        /**
+         * @brief Set every system's bet for the next round from its true count
+         *
+         */
+        void PlaceBets();
+
+        /**
+         * @brief Settle the round with every system's bet
+         *
+         * @param result - win per unit bet, 1 for a win and -1 for a loss
+         */
+        void SettleRound(double result);
+
+        /**
+         * @brief Get the number of systems
+         *
+         * @return size_t
+         */
+        size_t Systems() const;
+
+        /**
+         * @brief Get a system
+         *
+         * @param system - column of the system
+         * @return const CountingSystem&
+         */
+        const CountingSystem &System(size_t system) const;
+
+        /**
+         * @brief Get the running count of a system
+         *
+         * @param system - column of the system
+         * @return double
+         */
+        double RunningCount(size_t system) const;
+
+        /**
+         * @brief Get the running count of a system per deck left in the shoe
+         *
+         * @param system - column of the system
+         * @return double
+         */
+        double TrueCount(size_t system) const;
+
+        /**
+         * @brief Get the bet of a system for the round being played
+         *
+         * @param system - column of the system
+         * @return int - units
+         */
+        int Bet(size_t system) const;
+
+        /**
+         * @brief Get the units a system has wagered
+         *
+         * @param system - column of the system
+         * @return uint64_t
+         */
+        uint64_t Wagered(size_t system) const;
+
+        /**
+         * @brief Get a system's win per round in units
+         *
+         * @param system - column of the system
+         * @return const RunningStats&
+         */
+        const RunningStats &Results(size_t system) const;
+    };
+
+    /**
+     * @brief CountedDeck deals from a deck and shows every card to a MultiCounter, so it can be
+     *        passed to PlayBlackJack in place of the deck
+     *
+     * @tparam TDeck - Deck or InfiniteDeck
+     */
+    template <typename TDeck>
+    class CountedDeck
+    {
+    private:
+        /// @brief Deck dealt from
+        TDeck &_deck;
+        /// @brief Counter shown every card
+        MultiCounter &_counter;
+
+    public:
+        /**
+         * @brief Construct a new CountedDeck
+         *
+         * @param deck
+         * @param counter
+         */
+        CountedDeck(TDeck &deck, MultiCounter &counter) : _deck(deck), _counter(counter)
+        {
+        }
+
+        /**
+         * @brief Deal a card from the deck and count it
+         *
+         * @return Card
+         */
+        Card Deal()
+        {
+            Card card = _deck.Deal();
+            _counter.AddCard(card);
+            return card;
+        }
+
+        /**
+         * @brief Get the number of cards left in the deck
+         *
+         * @return int
+         */
+        int CardsInDeck()
+        {
+            return _deck.CardsInDeck();
+        }
+    };
+}
@@ -0,0 +1,118 @@
+/**
+ * @file Philox.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header only Philox4x32-10 counter-based random number generator. The output for a
+ *        (key, counter) pair is computed directly, so any round's random numbers can be
+ *        regenerated without replaying the rounds before it.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chants
+{
+
+    /**
+     * @brief Run the Philox4x32-10 bijection on a counter in place
+     *
+     * @param counter - four 32 bit words, replaced by the four random outputs
+     * @param key0 - low word of the key
+     * @param key1 - high word of the key
+     */
+    inline void Philox4x32(uint32_t *counter, uint32_t key0, uint32_t key1)
+    {
+        for (int round = 0; round < 10; round++)
+        {
+            uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * counter[0];
+            uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * counter[2];
+            uint32_t c0 = static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key0;
+            uint32_t c2 = static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key1;
+            counter[0] = c0;
+            counter[1] = static_cast<uint32_t>(product1);
+            counter[2] = c2;
+            counter[3] = static_cast<uint32_t>(product0);
+            key0 += 0x9E3779B9u;
+            key1 += 0xBB67AE85u;
+        }
+    }
+
+    /**
+     * @brief PhiloxStream hands out the random numbers of one stream, for example one round.
+     *        The key is the seed and the counter is (block, stream), so two streams of the same
+     *        seed never share a block and stream k starts at its first number in O(1).
+     */
+    class PhiloxStream
+    {
+    private:
+        /// @brief Key words, from the seed
+        uint32_t _key[2];
+        /// @brief Stream index words, from the stream number
+        uint32_t _stream[2];
+        /// @brief Index of the next block of four outputs
+        uint64_t _block;
+        /// @brief Current block of outputs
+        uint32_t _output[4];
+        /// @brief Outputs of the current block already handed out
+        int _used;
+
+    public:
+        /**
+         * @brief Construct a new PhiloxStream
+         *
+         * @param seed - the key shared by every stream of a run
+         * @param stream - the stream number, for example the round index
+         */
+        PhiloxStream(uint64_t seed, uint64_t stream)
+        {
+            _key[0] = static_cast<uint32_t>(seed);
+            _key[1] = static_cast<uint32_t>(seed >> 32);
+            _stream[0] = static_cast<uint32_t>(stream);
+            _stream[1] = static_cast<uint32_t>(stream >> 32);
+            _block = 0;
+            _used = 4;
+        }
+
+        /**
+         * @brief Get the next 32 bit random number of the stream
+         *
+         * @return uint32_t
+         */
+        uint32_t Next()
+        {
+            if (_used == 4)
+            {
+                _output[0] = static_cast<uint32_t>(_block);
+                _output[1] = static_cast<uint32_t>(_block >> 32);
+                _output[2] = _stream[0];
+                _output[3] = _stream[1];
+                Philox4x32(_output, _key[0], _key[1]);
+                _block++;
+                _used = 0;
+            }
+            return _output[_used++];
+        }
+
+        /**
+         * @brief Get a random number from 0 to range - 1 without modulo bias, using Lemire's
+         *        multiply-shift and redrawing the few values that would be biased
+         *
+         * @param range - 1 or more
+         * @return uint32_t
+         */
+        uint32_t Bounded(uint32_t range)
+        {
+            uint64_t m = static_cast<uint64_t>(Next()) * range;
+            if (static_cast<uint32_t>(m) < range)
+            {
+                const uint32_t threshold = (0u - range) % range;
+                while (static_cast<uint32_t>(m) < threshold)
+                    m = static_cast<uint64_t>(Next()) * range;
+            }
+            return static_cast<uint32_t>(m >> 32);
+        }
+    };
+}
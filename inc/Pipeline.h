@@ -0,0 +1,132 @@
+/**
+ * @file Pipeline.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the Pipeline class, a multi-threaded simulation engine that separates
+ *        shuffling shoes, playing rounds and folding results into stages connected by lock-free queues.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <ShuffleKernel.h>
+#include <Statistics.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief Settings for a Pipeline run
+     */
+    struct PipelineConfig
+    {
+        /// @brief Number of threads shuffling shoes
+        int shufflerThreads = 1;
+        /// @brief Number of threads playing rounds
+        int playerThreads = 1;
+        /// @brief Number of slots of shoes in flight, bounds the memory and the queues
+        int queueCapacity = 64;
+        /// @brief Number of shoes in a slot, shuffled together by ShuffleKernel::ShuffleRounds a batch of Lanes at a time
+        int shoesPerSlot = ShuffleKernel::Lanes;
+        /// @brief Number of decks in a shoe
+        int decksPerShoe = 1;
+        /// @brief Number of rounds to play, one fresh shoe per round
+        uint64_t rounds = 100000;
+        /// @brief Seed of the run, round k is shuffled with ShuffleKernel::ShuffleRound(seed, k)
+        uint64_t seed = 0;
+        /// @brief Threshold of each seat, the number of entries is the number of seats
+        vector<int> thresholds;
+        /// @brief Ends the run before rounds when the win rates are precise enough
+        EarlyStop earlyStop;
+    };
+
+    /**
+     * @brief Work and wait time of one stage, summed over its threads
+     */
+    struct StageStats
+    {
+        /// @brief Number of threads in the stage
+        int threads = 0;
+        /// @brief Number of slots the stage handled
+        uint64_t items = 0;
+        /// @brief Time spent working
+        uint64_t busyNanos = 0;
+        /// @brief Time spent waiting on an empty input queue
+        uint64_t starvedNanos = 0;
+        /// @brief Time spent waiting on a full output queue, the backpressure from the next stage
+        uint64_t blockedNanos = 0;
+
+        /**
+         * @brief Get the items handled per second of busy time per thread, what one more thread would add
+         *
+         * @return double
+         */
+        double ThroughputPerThread() const;
+    };
+
+    /**
+     * @brief Results and stage statistics of a Pipeline run
+     */
+    struct PipelineReport
+    {
+        /**
+         * @brief Construct an empty report
+         *
+         * @param seats
+         */
+        explicit PipelineReport(int seats) : stats(seats)
+        {
+        }
+
+        /// @brief Shuffler stage
+        StageStats shuffle;
+        /// @brief Player stage
+        StageStats play;
+        /// @brief Aggregator stage
+        StageStats aggregate;
+        /// @brief Wall clock time of the run
+        double seconds = 0;
+        /// @brief Rounds that ran out of cards and were not counted
+        uint64_t overDealt = 0;
+        /// @brief True when the run ended early because the win rates were precise enough
+        bool stoppedEarly = false;
+        /// @brief Statistics of every round played
+        SimulationStats stats;
+    };
+
+    /**
+     * @brief Pipeline runs a simulation as three stages. Shuffler threads fill free slots with
+     *        shuffled shoes and queue them, player threads play every shoe of a ready slot with
+     *        PlayRound into the slot's own SimulationStats, and one aggregator thread merges those
+     *        and hands the slot back. The aggregator is the only writer of the totals, so no lock is
+     *        needed, and it checks the early stop after every merge.
+     *        All slot memory is allocated up front, the stages only pass slot numbers.
+     */
+    class Pipeline
+    {
+    private:
+        /// @brief Settings of the run
+        PipelineConfig _config;
+
+    public:
+        /**
+         * @brief Construct a new Pipeline object
+         *
+         * @param config
+         * @throws runtime_error if a setting is out of range
+         */
+        explicit Pipeline(const PipelineConfig &config);
+
+        /**
+         * @brief Run the simulation to completion
+         *
+         * @return PipelineReport
+         */
+        PipelineReport Run();
+    };
+}
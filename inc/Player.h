@@ -29,6 +29,9 @@ namespace chants
         string _name;
         /// @brief The hand of the player
         vector<Card> _hand;
+        /// @brief Cards reserved for the hand up front, a one deck hand holds at most 11 cards
+        ///        before reaching 21, so reused players never grow their hand
+        static const int ReservedCards = 11;
         /// @brief The threshold for the player to win
         int _winThreshold;
 
@@ -62,11 +65,11 @@ namespace chants
         int GetThreshold();
 
         /**
-         * @brief Get the Name object
+         * @brief Get the Name object without copying it
          *
-         * @return string
+         * @return const string& - valid while the player lives
          */
-        string GetName();
+        const string &GetName() const;
 
         /**
          * @brief Add a card to the player's hand
@@ -83,7 +86,8 @@ namespace chants
         string ShowHand();
 
         /**
-         * @brief Empty the player's hand
+         * @brief Empty the player's hand and clear isBusted and isWinner, so the same player
+         *        can play another round
          *
          */
         void EmptyHand();
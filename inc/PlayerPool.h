@@ -0,0 +1,205 @@
+/**
+ * @file PlayerPool.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the PlayerPool class, which makes players for very large tournaments
+ *        out of one arena: the players, their hands and their interned names.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <Card.h>
+#include <MonotonicArena.h>
+#include <StringInterner.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief PooledPlayer has the playing interface of Player, so PlayBlackJack can deal to it,
+     *        but its name is an interned view and its hand lives in the pool's arena. Its totals
+     *        are kept as cards are added instead of being summed on every call, and give the
+     *        same score as Player.
+     */
+    class PooledPlayer
+    {
+    private:
+        /// @brief Interned name
+        NameView _name;
+        /// @brief Threshold to stop drawing at
+        int _winThreshold;
+        /// @brief Cards of the hand, in arena memory
+        Card *_hand;
+        /// @brief Cards in the hand
+        int _cards;
+        /// @brief Room in _hand
+        int _capacity;
+        /// @brief Points of the hand with every Ace counted as 11
+        int _total;
+        /// @brief Aces in the hand
+        int _aces;
+        /// @brief Where a full hand gets more room
+        MonotonicArena *_arena;
+
+    public:
+        /// @brief Cards a hand has room for from the start: the longest hand a threshold player
+        ///        can draw from one deck, four Aces, four 2s and three 3s. A longer hand takes a
+        ///        bigger room from the pool's arena, which is not thread safe, so players dealt on
+        ///        several threads at once must be dealt from one deck.
+        static const int HandCards = 11;
+
+        /// @brief True when the score is over 21
+        bool isBusted;
+
+        /// @brief True when the player won the round
+        bool isWinner;
+
+        /**
+         * @brief Construct a new PooledPlayer, use PlayerPool::Add
+         *
+         * @param name - interned name
+         * @param threshold - 1 - 21
+         * @param arena - memory for the hand
+         * @throws runtime_error if the threshold is out of range
+         */
+        PooledPlayer(NameView name, int threshold, MonotonicArena *arena);
+
+        /**
+         * @brief Get the name
+         *
+         * @return NameView - valid until the pool is released
+         */
+        NameView GetName() const;
+
+        /**
+         * @brief Get the threshold
+         *
+         * @return int
+         */
+        int GetThreshold() const;
+
+        /**
+         * @brief Add a card to the hand. Past HandCards cards the hand grows from the pool's
+         *        arena, so it must not run on two threads of one pool at once.
+         *
+         * @param card
+         */
+        void AddCard(Card card);
+
+        /**
+         * @brief Get the score of the hand
+         *
+         * @return int
+         */
+        int Score() const;
+
+        /**
+         * @brief Get the number of cards in the hand
+         *
+         * @return int
+         */
+        int CountCards() const;
+
+        /**
+         * @brief Empty the hand and clear isBusted and isWinner for a new round, keeping the
+         *        hand's memory
+         *
+         */
+        void EmptyHand();
+
+        /**
+         * @brief Turn every card face up or face down
+         *
+         * @param faceUp
+         */
+        void FlipAllCards(bool faceUp);
+
+        /**
+         * @brief Get the hand as text, the way Player::ShowHand does
+         *
+         * @return string
+         */
+        string ShowHand() const;
+    };
+
+    /**
+     * @brief PlayerPool owns a MonotonicArena holding every player, hand and name it makes, so a
+     *        tournament of millions of seats costs a few large allocations instead of several per
+     *        player, and Release frees all of it in one step.
+     */
+    class PlayerPool
+    {
+    private:
+        /// @brief Memory of the players, hands and names
+        MonotonicArena _arena;
+        /// @brief Table of distinct names
+        StringInterner _names;
+        /// @brief Every player made, in order
+        vector<PooledPlayer *> _players;
+
+    public:
+        /**
+         * @brief Construct an empty PlayerPool
+         *
+         * @param blockBytes - size of each arena block
+         */
+        explicit PlayerPool(size_t blockBytes = 1 << 20);
+
+        /**
+         * @brief Make a player
+         *
+         * @param name - copied into the name table unless already there
+         * @param threshold - 1 - 21
+         * @return PooledPlayer& - valid until Release
+         */
+        PooledPlayer &Add(NameView name, int threshold);
+
+        /**
+         * @brief Make room for more players up front
+         *
+         * @param players - total players expected
+         */
+        void Reserve(size_t players);
+
+        /**
+         * @brief Get the number of players
+         *
+         * @return size_t
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Get a player in the order made
+         *
+         * @param index
+         * @return PooledPlayer&
+         */
+        PooledPlayer &operator[](size_t index);
+
+        /**
+         * @brief Get the number of distinct names
+         *
+         * @return size_t
+         */
+        size_t Names() const;
+
+        /**
+         * @brief Get the bytes the pool has taken from the heap for players, hands and names
+         *
+         * @return size_t
+         */
+        size_t BytesReserved() const;
+
+        /**
+         * @brief Free every player, hand and name at once
+         *
+         */
+        void Release();
+    };
+}
@@ -0,0 +1,75 @@
+/**
+ * @file Round.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Plays one threshold round straight from a shoe of card codes (see CardCode.h).
+ *        This is the allocation free counterpart of PlayBlackJack and SortPlayers used by the simulators.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <CardCode.h>
+
+namespace chants
+{
+
+    /**
+     * @brief The outcome of one seat in a round played by PlayRound
+     */
+    struct SeatResult
+    {
+        /// @brief Offset in the shoe of the first card dealt to the seat
+        int first;
+        /// @brief Number of cards dealt to the seat
+        int cards;
+        /// @brief Final score, scored by HandScore
+        int score;
+        /// @brief True when the score is over 21
+        bool isBusted;
+        /// @brief True when the seat has the highest score of 21 or less, ties all win
+        bool isWinner;
+    };
+
+    /**
+     * @brief Add a card to a hand's running totals and score it with HandScore, as Player does
+     *
+     * @param points - points of the hand with every Ace counted as 11
+     * @param aces - number of Aces in the hand
+     * @param code - card code to add
+     * @return int - score of the hand with the card
+     */
+    inline int AddToScore(int &points, int &aces, uint8_t code)
+    {
+        int cardPoints = CodeToPoints(code);
+        if (cardPoints == 11)
+            aces++;
+        points += cardPoints;
+        return HandScore(points, aces);
+    }
+
+    /**
+     * @brief Play one round the way PlayBlackJack does: seats are dealt in order from the top of
+     *        the shoe, each takes two cards and then draws while its score is below its threshold.
+     *        Winners are then marked the way SortPlayers does, without reordering the seats.
+     *        Like Deck::Deal, the last card of the shoe is never dealt.
+     *
+     * @param shoe - card codes, the first code is dealt first
+     * @param shoeSize - number of codes in shoe
+     * @param thresholds - threshold of each seat, 1 - 21
+     * @param seats - number of seats
+     * @param results - one SeatResult per seat
+     * @return int - number of cards dealt, or -1 if the shoe ran out of cards
+     */
+    int PlayRound(const uint8_t *shoe, int shoeSize, const int *thresholds, int seats, SeatResult *results);
+
+    /**
+     * @brief Mark the winners of a round: every seat that is not busted and has the highest score
+     *
+     * @param results - one SeatResult per seat
+     * @param seats - number of seats
+     */
+    void MarkWinners(SeatResult *results, int seats);
+}
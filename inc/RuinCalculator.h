@@ -0,0 +1,117 @@
+/**
+ * @file RuinCalculator.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the RuinCalculator class, which computes the exact bankroll
+ *        distribution after any number of hands, with ruin as an absorbing barrier, by
+ *        convolving the outcome distribution of one hand.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief Bankroll distribution at the end of a session
+     */
+    struct SessionDistribution
+    {
+        /// @brief Bankroll of probabilities[0]
+        double lowest = 0;
+        /// @brief Bankroll between neighbouring entries
+        double step = 1;
+        /// @brief Probability of ending with each bankroll without having been ruined
+        vector<double> probabilities;
+        /// @brief Probability of having been ruined by the end of each hand, ruinByHand[0] is hand 1
+        vector<double> ruinByHand;
+
+        /**
+         * @brief Get the probability of being ruined during the session
+         *
+         * @return double
+         */
+        double Ruin() const;
+
+        /**
+         * @brief Get the probability of ending below a bankroll, ruined sessions included
+         *
+         * @param bankroll
+         * @return double
+         */
+        double Below(double bankroll) const;
+
+        /**
+         * @brief Get the mean final bankroll of the sessions that were not ruined
+         *
+         * @return double
+         */
+        double SurvivorMean() const;
+    };
+
+    /**
+     * @brief RuinCalculator works on a lattice: every outcome of one hand is a whole number of
+     *        steps, so a bankroll is an index and one hand is a convolution with the outcome
+     *        distribution. The ruin barrier breaks plain convolution powers, so hands are taken
+     *        in blocks of k. Bankrolls more than k worst losses above the barrier cannot be
+     *        ruined within the block and are convolved with the k-fold distribution by FFT in
+     *        one step. Only the band just above the barrier is stepped hand by hand, moving what
+     *        falls through into the ruin total. The result is exact up to rounding; ends of the
+     *        distribution below 1e-16 are trimmed.
+     */
+    class RuinCalculator
+    {
+    private:
+        /// @brief Bankroll between lattice points
+        double _step;
+        /// @brief Probability of each lattice outcome, from _lowestOutcome up
+        vector<double> _kernel;
+        /// @brief Outcome of _kernel[0], in steps, negative for a loss
+        int64_t _lowestOutcome;
+
+    public:
+        /**
+         * @brief Construct a RuinCalculator from the results of one hand
+         *
+         * @param outcomes - result of one hand in bet units
+         * @param weights - how often each outcome happens, need not add up to 1
+         * @param step - lattice step, 0 to find the coarsest of 1, 1/2, 1/4, 1/5, 1/10, 1/20
+         *               and 1/100 that fits every outcome
+         * @throws runtime_error if the outcomes are not on the lattice or weigh nothing
+         */
+        RuinCalculator(const vector<double> &outcomes, const vector<double> &weights, double step = 0);
+
+        /**
+         * @brief Get the lattice step
+         *
+         * @return double
+         */
+        double Step() const;
+
+        /**
+         * @brief Compute the bankroll distribution after a number of hands
+         *
+         * @param bankroll - bankroll at the start
+         * @param hands - hands in the session
+         * @param floor - a bankroll below this is ruined and stops playing, 1 for a one unit bet
+         * @return SessionDistribution
+         */
+        SessionDistribution Session(double bankroll, uint64_t hands, double floor = 1.0) const;
+
+        /**
+         * @brief Convolve two sequences with a radix-2 FFT
+         *
+         * @param a
+         * @param b
+         * @return vector<double> - a.size() + b.size() - 1 entries
+         */
+        static vector<double> Convolve(const vector<double> &a, const vector<double> &b);
+    };
+}
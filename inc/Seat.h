@@ -0,0 +1,112 @@
+/**
+ * @file Seat.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief The rules of one seat and of the winners of a round, shared by every way a round is played:
+ *        PlayBlackJack and SortPlayers, Table, TableScheduler, Tournament and PlayRound.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace chants
+{
+
+    /**
+     * @brief Get the player in a seat, whether players are held by value or by pointer
+     *
+     * @param player
+     * @return TPlayer&
+     */
+    template <typename TPlayer>
+    TPlayer &SeatAt(TPlayer &player)
+    {
+        return player;
+    }
+
+    template <typename TPlayer>
+    TPlayer &SeatAt(TPlayer *player)
+    {
+        return *player;
+    }
+
+    /**
+     * @brief Empty a seat's hand and deal it the two opening cards
+     *
+     * @param player - a Player, or any type with its playing interface
+     * @param deck - a Deck, or any type with Deal
+     * @throws whatever Deal throws when the deck runs out
+     */
+    template <typename TPlayer, typename TDeck>
+    void DealOpening(TPlayer &player, TDeck &deck)
+    {
+        player.EmptyHand();
+        player.AddCard(deck.Deal());
+        player.AddCard(deck.Deal());
+    }
+
+    /**
+     * @brief Finish a seat that has stopped drawing: mark it busted when over 21 and turn its cards up
+     *
+     * @param player
+     * @return int - final score of the seat
+     */
+    template <typename TPlayer>
+    int SettleSeat(TPlayer &player)
+    {
+        int score = player.Score();
+        if (score > 21)
+            player.isBusted = true;
+        player.FlipAllCards(true);
+        return score;
+    }
+
+    /**
+     * @brief Play a seat: deal the opening cards, draw while the score is below the threshold,
+     *        then settle it
+     *
+     * @param player
+     * @param deck
+     * @return int - number of cards dealt to the seat
+     * @throws whatever Deal throws when the deck runs out
+     */
+    template <typename TPlayer, typename TDeck>
+    int PlaySeat(TPlayer &player, TDeck &deck)
+    {
+        DealOpening(player, deck);
+        int dealt = 2;
+        while (player.Score() < player.GetThreshold())
+        {
+            player.AddCard(deck.Deal());
+            dealt++;
+        }
+        SettleSeat(player);
+        return dealt;
+    }
+
+    /**
+     * @brief Mark the winners of settled seats: every seat that is not busted and has the highest
+     *        score wins, ties all win. The seats are not reordered.
+     *
+     * @param players - Players or PooledPlayers, held by value or by pointer
+     */
+    template <typename TPlayers>
+    void MarkWinners(TPlayers &players)
+    {
+        int highestScore = -1;
+        for (size_t i = 0; i < players.size(); i++)
+        {
+            auto &player = SeatAt(players[i]);
+            if (!player.isBusted && player.Score() > highestScore)
+                highestScore = player.Score();
+        }
+        for (size_t i = 0; i < players.size(); i++)
+        {
+            auto &player = SeatAt(players[i]);
+            player.isWinner = !player.isBusted && player.Score() == highestScore;
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file ShuffleKernel.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the ShuffleKernel class, which shuffles many shoes at once into
+ *        one contiguous buffer of card codes (see CardCode.h).
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <CardCode.h>
+
+namespace chants
+{
+
+    /**
+     * @brief ShuffleKernel generates batches of shuffled shoes. It keeps several independent
+     *        xoshiro128** generators side by side, one per lane, and shuffles one shoe per lane
+     *        so every step of the Fisher-Yates shuffle is a plain loop over the lanes that the
+     *        compiler can vectorize. Indexes are drawn with Lemire's multiply-shift method,
+     *        which rejects the few biased values instead of using modulo.
+     */
+    class ShuffleKernel
+    {
+    public:
+        /// @brief Number of generator streams, and the number of shoes shuffled together
+        static const int Lanes = 8;
+
+        /**
+         * @brief Construct a new ShuffleKernel, seeding every lane from one seed
+         *
+         * @param seed
+         */
+        explicit ShuffleKernel(uint64_t seed);
+
+        /**
+         * @brief Shuffle shoes into out. Shoe k occupies out[k * 52 * decksPerShoe] up to
+         *        the start of shoe k + 1, and contains every card code decksPerShoe times.
+         *
+         * @param out - buffer of at least shoes * 52 * decksPerShoe bytes
+         * @param shoes - number of shoes to generate
+         * @param decksPerShoe - number of 52 card decks in each shoe, 1 or more
+         */
+        void ShuffleBatch(uint8_t *out, int shoes, int decksPerShoe);
+
+        /**
+         * @brief Fill one shoe with decksPerShoe unshuffled decks, in the same order as Deck(false)
+         *
+         * @param shoe - buffer of at least 52 * decksPerShoe bytes
+         * @param decksPerShoe
+         */
+        static void FillOrdered(uint8_t *shoe, int decksPerShoe);
+
+        /**
+         * @brief Shuffle the shoe of one round with a Philox stream keyed by (seed, round).
+         *        The same seed and round always give the same shoe, so any round of a run can
+         *        be regenerated on its own, and threads shuffling different rounds never overlap.
+         *
+         * @param seed - seed of the run
+         * @param round - index of the round
+         * @param shoe - buffer of at least 52 * decksPerShoe bytes
+         * @param decksPerShoe - number of decks in the shoe, 1 or more
+         */
+        static void ShuffleRound(uint64_t seed, uint64_t round, uint8_t *shoe, int decksPerShoe);
+
+        /**
+         * @brief Shuffle the shoes of rounds firstRound to firstRound + shoes - 1, each into the
+         *        same order as ShuffleRound, Lanes rounds at a time. The Philox blocks of all
+         *        lanes are generated together and every Fisher-Yates step swaps in every lane,
+         *        so both loops run over the lanes the way ShuffleBatch does.
+         *
+         * @param seed - seed of the run
+         * @param firstRound - index of the round of the first shoe
+         * @param out - buffer of at least shoes * 52 * decksPerShoe bytes, shoe k at
+         *              out[k * 52 * decksPerShoe]
+         * @param shoes - number of shoes to generate
+         * @param decksPerShoe - number of decks in each shoe, 1 or more
+         */
+        static void ShuffleRounds(uint64_t seed, uint64_t firstRound, uint8_t *out, int shoes, int decksPerShoe);
+
+    private:
+        /// @brief xoshiro128** state, one word of each array per lane
+        uint32_t _s0[Lanes];
+        uint32_t _s1[Lanes];
+        uint32_t _s2[Lanes];
+        uint32_t _s3[Lanes];
+
+        /**
+         * @brief Advance every lane and write one 32 bit output per lane
+         *
+         * @param out
+         */
+        void nextLanes(uint32_t *out);
+
+        /**
+         * @brief Advance a single lane, used to redraw a rejected index
+         *
+         * @param lane
+         * @return uint32_t
+         */
+        uint32_t nextLane(int lane);
+    };
+}
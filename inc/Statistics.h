@@ -0,0 +1,238 @@
+/**
+ * @file Statistics.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the streaming statistics of a simulation: running mean and variance,
+ *        score histograms, bust rates and win streaks. Every statistic can be merged with another
+ *        one, so each thread keeps its own and they are combined once at the end of a batch.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Round.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief RunningStats keeps the count, mean and variance of a stream of values with
+     *        Welford's update, and merges two streams with Chan's parallel formula.
+     */
+    class RunningStats
+    {
+    private:
+        /// @brief Number of values added
+        uint64_t _count;
+        /// @brief Mean of the values
+        double _mean;
+        /// @brief Sum of squared differences from the mean
+        double _m2;
+
+    public:
+        /**
+         * @brief Construct an empty RunningStats
+         *
+         */
+        RunningStats();
+
+        /**
+         * @brief Add a value
+         *
+         * @param value
+         */
+        void Add(double value);
+
+        /**
+         * @brief Add the values of another stream
+         *
+         * @param other
+         */
+        void Merge(const RunningStats &other);
+
+        /**
+         * @brief Get the number of values
+         *
+         * @return uint64_t
+         */
+        uint64_t Count() const;
+
+        /**
+         * @brief Get the mean, 0 when empty
+         *
+         * @return double
+         */
+        double Mean() const;
+
+        /**
+         * @brief Get the sample variance, 0 with fewer than two values
+         *
+         * @return double
+         */
+        double Variance() const;
+
+        /**
+         * @brief Get the half width of the confidence interval of the mean
+         *
+         * @param z - normal quantile of the interval, 1.96 for 95%
+         * @return double
+         */
+        double HalfWidth(double z) const;
+    };
+
+    /**
+     * @brief Settings to end a run once the win rate of every seat is known precisely enough
+     */
+    struct EarlyStop
+    {
+        /// @brief Largest accepted confidence interval half width of a win rate, 0 turns early stop off
+        double halfWidth = 0;
+        /// @brief Normal quantile of the confidence interval, 1.96 for 95%
+        double z = 1.96;
+        /// @brief Rounds to play before the interval is trusted
+        uint64_t minRounds = 1000;
+    };
+
+    /**
+     * @brief SimulationStats collects the results of the rounds of one thread or batch:
+     *        histograms of final scores per seat, bust rates per seat and per threshold,
+     *        win streaks per seat and running statistics of wins and scores.
+     */
+    class SimulationStats
+    {
+    public:
+        /// @brief Highest score a threshold player can reach, 20 plus a ten
+        static const int MaxScore = 30;
+
+    private:
+        /// @brief Number of seats
+        int _seats;
+        /// @brief Rounds added
+        uint64_t _rounds;
+        /// @brief Count of each final score, (MaxScore + 1) entries per seat
+        vector<uint64_t> _scores;
+        /// @brief Busts of each seat
+        vector<uint64_t> _busts;
+        /// @brief Seat rounds played with each threshold 0 - 21
+        vector<uint64_t> _thresholdRounds;
+        /// @brief Seat busts with each threshold 0 - 21
+        vector<uint64_t> _thresholdBusts;
+        /// @brief Wins at the start of the stream before the first loss, per seat
+        vector<uint64_t> _leadingStreak;
+        /// @brief Wins at the end of the stream since the last loss, per seat
+        vector<uint64_t> _currentStreak;
+        /// @brief Longest run of wins, per seat
+        vector<uint64_t> _longestStreak;
+        /// @brief Win indicator statistics, per seat
+        vector<RunningStats> _winStats;
+        /// @brief Final score statistics, per seat
+        vector<RunningStats> _scoreStats;
+
+    public:
+        /**
+         * @brief Construct empty statistics for a number of seats
+         *
+         * @param seats
+         */
+        explicit SimulationStats(int seats);
+
+        /**
+         * @brief Add the results of one round
+         *
+         * @param results - one SeatResult per seat
+         * @param thresholds - threshold each seat played with
+         */
+        void AddRound(const SeatResult *results, const int *thresholds);
+
+        /**
+         * @brief Add the statistics of another stream as if its rounds were played after these.
+         *        Everything except the streaks is independent of the order.
+         *
+         * @param other - statistics with the same number of seats
+         * @throws runtime_error if the number of seats differs
+         */
+        void Merge(const SimulationStats &other);
+
+        /**
+         * @brief Forget every round, keeping the memory
+         *
+         */
+        void Clear();
+
+        /**
+         * @brief Get the number of seats
+         *
+         * @return int
+         */
+        int Seats() const;
+
+        /**
+         * @brief Get the number of rounds
+         *
+         * @return uint64_t
+         */
+        uint64_t Rounds() const;
+
+        /**
+         * @brief Get how many times a seat finished with a score
+         *
+         * @param seat
+         * @param score - 0 - MaxScore
+         * @return uint64_t
+         */
+        uint64_t ScoreCount(int seat, int score) const;
+
+        /**
+         * @brief Get the number of busts of a seat
+         *
+         * @param seat
+         * @return uint64_t
+         */
+        uint64_t Busts(int seat) const;
+
+        /**
+         * @brief Get the fraction of seat rounds played with a threshold that busted
+         *
+         * @param threshold - 1 - 21
+         * @return double - 0 when the threshold was never played
+         */
+        double BustRateAtThreshold(int threshold) const;
+
+        /**
+         * @brief Get the longest run of wins of a seat
+         *
+         * @param seat
+         * @return uint64_t
+         */
+        uint64_t LongestWinStreak(int seat) const;
+
+        /**
+         * @brief Get the win statistics of a seat, the mean is the win rate
+         *
+         * @param seat
+         * @return const RunningStats&
+         */
+        const RunningStats &Wins(int seat) const;
+
+        /**
+         * @brief Get the final score statistics of a seat
+         *
+         * @param seat
+         * @return const RunningStats&
+         */
+        const RunningStats &Scores(int seat) const;
+
+        /**
+         * @brief Check if every seat's win rate is known to the precision asked for
+         *
+         * @param stop
+         * @return true when early stop is on, enough rounds were played and every half width is small enough
+         */
+        bool ReachedPrecision(const EarlyStop &stop) const;
+    };
+}
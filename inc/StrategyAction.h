@@ -0,0 +1,31 @@
+/**
+ * @file StrategyAction.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief The decisions a player can make against a dealer, shared by the strategy solver and the
+ *        generated BasicStrategy.h tables.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chants
+{
+    /**
+     * @brief One player decision
+     */
+    enum StrategyAction : uint8_t
+    {
+        /// @brief Take no more cards
+        StrategyStand = 0,
+        /// @brief Take one card and decide again
+        StrategyHit = 1,
+        /// @brief Double the bet, take exactly one card and stand
+        StrategyDouble = 2,
+        /// @brief Split a pair into two hands
+        StrategySplit = 3
+    };
+}
@@ -0,0 +1,144 @@
+/**
+ * @file StrategySolver.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the StrategySolver class, which computes the expected value of standing,
+ *        hitting, doubling and splitting in every hand state and writes the best decisions as a
+ *        header of constexpr lookup tables.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <ostream>
+#include <vector>
+#include <StrategyAction.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief Table rules the strategy is solved for
+     */
+    struct StrategyRules
+    {
+        /// @brief Number of decks in the shoe
+        int decks = 6;
+        /// @brief True when the dealer hits soft 17, false when the dealer stands on all 17s
+        bool dealerHitsSoft17 = false;
+        /// @brief True when a hand made by splitting may be doubled
+        bool doubleAfterSplit = true;
+    };
+
+    /**
+     * @brief StrategySolver computes expected values per unit bet for every (player total, soft,
+     *        dealer upcard) state. The dealer peeks for blackjack, so every value is given that the
+     *        dealer does not have one. The shoe is the given number of decks less the upcard, and
+     *        cards after that are drawn with those fixed probabilities. A split hand is played
+     *        once, without resplitting, and split Aces take one card each.
+     *
+     *        Results are memoized per upcard, and the ten upcards are solved on separate threads.
+     */
+    class StrategySolver
+    {
+    public:
+        /// @brief Highest total kept in the tables
+        static const int MaxTotal = 21;
+        /// @brief Number of upcards, 2 - 11 where 11 is an Ace
+        static const int Upcards = 10;
+
+    private:
+        /// @brief Rules being solved
+        StrategyRules _rules;
+        /// @brief True once Solve has run
+        bool _solved;
+        /// @brief Expected value of standing, [upcard - 2][total]
+        vector<double> _stand;
+        /// @brief Expected value of hitting and then playing on without doubling, [upcard - 2][soft][total]
+        vector<double> _hit;
+        /// @brief Expected value of doubling, [upcard - 2][soft][total]
+        vector<double> _double;
+        /// @brief Expected value of splitting a pair, [upcard - 2][pair card points]
+        vector<double> _split;
+
+        /**
+         * @brief Solve every state of one upcard
+         *
+         * @param upcard - 2 - 11
+         */
+        void solveUpcard(int upcard);
+
+        /**
+         * @brief Make sure Solve has run
+         *
+         * @throws runtime_error if it has not
+         */
+        void checkSolved() const;
+
+    public:
+        /**
+         * @brief Construct a new StrategySolver
+         *
+         * @param rules
+         * @throws runtime_error if the deck count is below 1
+         */
+        explicit StrategySolver(const StrategyRules &rules);
+
+        /**
+         * @brief Compute every expected value
+         *
+         * @param threads - number of threads, 0 for one per core
+         */
+        void Solve(int threads = 0);
+
+        /**
+         * @brief Get the expected value of an action in a hand state
+         *
+         * @param action - StrategyStand, StrategyHit or StrategyDouble
+         * @param total - player total 4 - 21
+         * @param soft - true when an Ace counts as 11
+         * @param upcard - dealer upcard points 2 - 11
+         * @return double - expected win per unit bet
+         */
+        double ExpectedValue(StrategyAction action, int total, bool soft, int upcard) const;
+
+        /**
+         * @brief Get the expected value of splitting a pair, for both hands together
+         *
+         * @param pairCard - points of one card of the pair, 2 - 11
+         * @param upcard - dealer upcard points 2 - 11
+         * @return double - expected win per unit of the original bet
+         */
+        double SplitValue(int pairCard, int upcard) const;
+
+        /**
+         * @brief Get the best of stand, hit and, when allowed, double
+         *
+         * @param total - player total 4 - 21
+         * @param soft - true when an Ace counts as 11
+         * @param upcard - dealer upcard points 2 - 11
+         * @param canDouble - true on the first two cards
+         * @return StrategyAction
+         */
+        StrategyAction Best(int total, bool soft, int upcard, bool canDouble) const;
+
+        /**
+         * @brief Check if splitting a pair is better than playing it as a total
+         *
+         * @param pairCard - points of one card of the pair, 2 - 11
+         * @param upcard - dealer upcard points 2 - 11
+         * @return true to split
+         */
+        bool ShouldSplit(int pairCard, int upcard) const;
+
+        /**
+         * @brief Write the best decisions as a C++ header of constexpr tables, see BasicStrategy.h
+         *
+         * @param out
+         */
+        void WriteHeader(ostream &out) const;
+    };
+}
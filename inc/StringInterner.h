@@ -0,0 +1,203 @@
+/**
+ * @file StringInterner.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for NameView, a non-owning view of a name, and the StringInterner class,
+ *        which keeps one copy of each distinct name in arena memory.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <MonotonicArena.h>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief NameView points at characters owned by someone else, like string_view, which this
+     *        C++14 code base cannot use. It converts to string_view when built as C++17 or later.
+     */
+    class NameView
+    {
+    private:
+        /// @brief First character, followed by a terminating zero when made by StringInterner
+        const char *_data;
+        /// @brief Number of characters
+        size_t _size;
+
+    public:
+        /**
+         * @brief Construct an empty view
+         *
+         */
+        NameView() : _data(""), _size(0)
+        {
+        }
+
+        /**
+         * @brief Construct a view of characters
+         *
+         * @param data - first character
+         * @param size - number of characters
+         */
+        NameView(const char *data, size_t size) : _data(data), _size(size)
+        {
+        }
+
+        /**
+         * @brief Construct a view of a zero terminated string
+         *
+         * @param text
+         */
+        NameView(const char *text) : _data(text), _size(strlen(text))
+        {
+        }
+
+        /**
+         * @brief Construct a view of a string, which must outlive the view
+         *
+         * @param text
+         */
+        NameView(const string &text) : _data(text.data()), _size(text.size())
+        {
+        }
+
+        /**
+         * @brief Get the first character
+         *
+         * @return const char*
+         */
+        const char *data() const
+        {
+            return _data;
+        }
+
+        /**
+         * @brief Get the number of characters
+         *
+         * @return size_t
+         */
+        size_t size() const
+        {
+            return _size;
+        }
+
+        /**
+         * @brief Copy the characters into a string
+         *
+         * @return string
+         */
+        string str() const
+        {
+            return string(_data, _size);
+        }
+
+#if __cplusplus >= 201703L
+        /**
+         * @brief View the same characters as a string_view
+         *
+         * @return string_view
+         */
+        operator string_view() const
+        {
+            return string_view(_data, _size);
+        }
+#endif
+
+        /**
+         * @brief Compare the characters of two views
+         *
+         * @param other
+         * @return true when they hold the same characters
+         */
+        bool operator==(const NameView &other) const
+        {
+            return _size == other._size && memcmp(_data, other._data, _size) == 0;
+        }
+
+        /**
+         * @brief Compare the characters of two views
+         *
+         * @param other
+         * @return true when they differ
+         */
+        bool operator!=(const NameView &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * @brief Write the characters of a view
+     *
+     * @param out
+     * @param name
+     * @return ostream&
+     */
+    inline ostream &operator<<(ostream &out, const NameView &name)
+    {
+        return out.write(name.data(), name.size());
+    }
+
+    /**
+     * @brief StringInterner stores each distinct string once, zero terminated, in a
+     *        MonotonicArena, and finds it again through an open addressing hash table. The views it
+     *        returns stay valid until Release, and equal strings get the same pointer.
+     */
+    class StringInterner
+    {
+    private:
+        /// @brief Storage of the characters
+        MonotonicArena &_arena;
+        /// @brief Hash table of interned strings, empty slots have a null data pointer
+        vector<NameView> _slots;
+        /// @brief Number of distinct strings
+        size_t _count;
+
+        /**
+         * @brief Double the table and put every string back
+         *
+         */
+        void rehash();
+
+    public:
+        /**
+         * @brief Construct an empty StringInterner
+         *
+         * @param arena - where the characters are stored, must outlive the interner
+         */
+        explicit StringInterner(MonotonicArena &arena);
+
+        /**
+         * @brief Get the interned copy of a string, copying it into the arena the first time
+         *
+         * @param text
+         * @return NameView - view of the interned copy
+         */
+        NameView Intern(NameView text);
+
+        /**
+         * @brief Get the number of distinct strings
+         *
+         * @return size_t
+         */
+        size_t Count() const;
+
+        /**
+         * @brief Forget every string; the arena owner releases the characters
+         *
+         */
+        void Clear();
+    };
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Table.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the Table class, one game table with its own Deck and players that
+ *        can play any number of rounds. Used by the game server to host many tables at once.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Deck.h>
+#include <Player.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief Table keeps a Deck and a vector of Players. Every round is dealt from the deck reset
+     *        and shuffled for (seed, round), and the players keep their seats between rounds.
+     */
+    class Table
+    {
+    private:
+        /// @brief Seed of the table's rounds
+        uint64_t _seed;
+        /// @brief Index of the next round
+        uint64_t _round;
+        /// @brief The deck of the current round
+        Deck _deck;
+        /// @brief The players, in seat order
+        vector<Player> _players;
+
+    public:
+        /**
+         * @brief Construct an empty Table
+         *
+         * @param seed - seed of the table's rounds
+         */
+        explicit Table(uint64_t seed);
+
+        /**
+         * @brief Seat a new player
+         *
+         * @param name
+         * @param threshold - 1 - 21
+         * @throws runtime_error if the threshold is out of range
+         */
+        void Join(const string &name, int threshold);
+
+        /**
+         * @brief Play one round: deal every seat in order as PlayBlackJack does and mark
+         *        the winners as SortPlayers does, keeping the seat order
+         *
+         * @return uint64_t - index of the round played
+         * @throws runtime_error if there are no players or the deck runs out
+         */
+        uint64_t Play();
+
+        /**
+         * @brief Get the players and their hands from the last round
+         *
+         * @return vector<Player>&
+         */
+        vector<Player> &Players();
+    };
+}
@@ -0,0 +1,304 @@
+/**
+ * @file TableScheduler.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the TableScheduler class, which runs thousands of tables on one thread
+ *        with C++20 coroutines. Every seat decision is awaited, so a person thinking at one table
+ *        never blocks the others. Only built when the project is configured with
+ *        -DBLACKJACK_CXX_STANDARD=20 or later; BLACKJACK_HAS_COROUTINES tells when it is there.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+#define BLACKJACK_HAS_COROUTINES 1
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Deck.h>
+#include <Player.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief TableScheduler keeps one coroutine per table that plays its queued rounds. A bot
+     *        seat's decision is ready at once, so its await never suspends and a table of bots
+     *        plays straight through. An interactive seat suspends its table until Decide gives
+     *        the answer, and the thread moves on to the next ready table.
+     *
+     *        Rounds are dealt like Table: round r of a table with seed s comes from Deck::Seeded(s, r),
+     *        seats in join order, ties for the best score all win. Players, deck and coroutine
+     *        frame are reused from round to round.
+     */
+    class TableScheduler
+    {
+    public:
+        /**
+         * @brief Coroutine type of a table, resumed only by the scheduler
+         */
+        struct TableTask
+        {
+            struct promise_type
+            {
+                /// @brief Exception thrown inside the table, rethrown by RunUntilIdle
+                exception_ptr error;
+
+                TableTask get_return_object()
+                {
+                    return TableTask{coroutine_handle<promise_type>::from_promise(*this)};
+                }
+                suspend_always initial_suspend() noexcept
+                {
+                    return {};
+                }
+                suspend_always final_suspend() noexcept
+                {
+                    return {};
+                }
+                void return_void()
+                {
+                }
+                void unhandled_exception()
+                {
+                    error = current_exception();
+                }
+            };
+
+            /// @brief The coroutine
+            coroutine_handle<promise_type> handle;
+        };
+
+    private:
+        /**
+         * @brief Everything one table needs, owned by the scheduler so its address is stable
+         */
+        struct TableState
+        {
+            /// @brief Index of the table
+            size_t index;
+            /// @brief Seed of the table's rounds
+            uint64_t seed;
+            /// @brief Rounds played
+            uint64_t played;
+            /// @brief Rounds queued and not yet played
+            uint64_t queued;
+            /// @brief Deck of the current round
+            Deck deck;
+            /// @brief Players in seat order
+            vector<Player> players;
+            /// @brief True for seats whose decisions come from Decide
+            vector<bool> interactive;
+            /// @brief Seat waiting for Decide, or -1
+            int waitingSeat;
+            /// @brief Answer given by Decide
+            bool decision;
+            /// @brief True while the table is in the ready queue
+            bool ready;
+            /// @brief The table's coroutine
+            TableTask task;
+
+            TableState(size_t tableIndex, uint64_t tableSeed);
+        };
+
+        /**
+         * @brief Awaited when a table has no round to play, parks it until QueueRounds
+         */
+        struct RoundsQueued
+        {
+            TableScheduler &scheduler;
+            TableState &table;
+
+            bool await_ready() const noexcept
+            {
+                return table.queued > 0;
+            }
+            void await_suspend(coroutine_handle<>) noexcept
+            {
+                scheduler._suspensions++;
+            }
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        /**
+         * @brief Awaited for every hit or stand decision. Bots answer in await_ready.
+         */
+        struct SeatDecision
+        {
+            TableScheduler &scheduler;
+            TableState &table;
+            int seat;
+            bool hit;
+
+            bool await_ready() noexcept
+            {
+                if (table.interactive[seat])
+                    return false;
+                Player &player = table.players[seat];
+                hit = player.Score() < player.GetThreshold();
+                return true;
+            }
+            void await_suspend(coroutine_handle<>) noexcept
+            {
+                table.waitingSeat = seat;
+                scheduler._suspensions++;
+            }
+            bool await_resume() noexcept
+            {
+                if (table.interactive[seat])
+                {
+                    table.waitingSeat = -1;
+                    hit = table.decision;
+                }
+                return hit;
+            }
+        };
+
+        /// @brief Every table, by index
+        vector<unique_ptr<TableState>> _tables;
+        /// @brief Tables ready to resume, in order
+        vector<size_t> _ready;
+        /// @brief Times a table suspended
+        uint64_t _suspensions;
+
+        /**
+         * @brief The coroutine of a table: wait for a queued round, play it, repeat
+         *
+         * @param table
+         * @return TableTask
+         */
+        TableTask run(TableState &table);
+
+        /**
+         * @brief Put a table in the ready queue unless it is already there
+         *
+         * @param table
+         */
+        void makeReady(TableState &table);
+
+        /**
+         * @brief Get a table by index
+         *
+         * @param table
+         * @return TableState&
+         * @throws out_of_range for an unknown table
+         */
+        TableState &state(size_t table) const;
+
+    public:
+        /**
+         * @brief Construct an empty TableScheduler
+         *
+         */
+        TableScheduler();
+
+        /**
+         * @brief Destroy the scheduler and every table's coroutine
+         *
+         */
+        ~TableScheduler();
+
+        TableScheduler(const TableScheduler &) = delete;
+        TableScheduler &operator=(const TableScheduler &) = delete;
+
+        /**
+         * @brief Open a table
+         *
+         * @param seed - seed of the table's rounds
+         * @return size_t - index of the table
+         */
+        size_t AddTable(uint64_t seed);
+
+        /**
+         * @brief Seat a bot that draws while its score is below its threshold
+         *
+         * @param table
+         * @param name
+         * @param threshold - 1 - 21
+         */
+        void JoinBot(size_t table, const string &name, int threshold);
+
+        /**
+         * @brief Seat a person whose every decision is given with Decide
+         *
+         * @param table
+         * @param name
+         */
+        void JoinInteractive(size_t table, const string &name);
+
+        /**
+         * @brief Queue rounds for a table, it plays them on the next RunUntilIdle
+         *
+         * @param table
+         * @param rounds
+         */
+        void QueueRounds(size_t table, uint64_t rounds);
+
+        /**
+         * @brief Resume ready tables until every table is out of rounds or waiting for a person
+         *
+         * @return size_t - number of resumes
+         * @throws whatever a table threw, for example when its deck runs out
+         */
+        size_t RunUntilIdle();
+
+        /**
+         * @brief Get the seat a table is waiting on
+         *
+         * @param table
+         * @return int - seat index, or -1 when the table waits for nobody
+         */
+        int WaitingSeat(size_t table) const;
+
+        /**
+         * @brief Answer the decision a table is waiting on, the table becomes ready
+         *
+         * @param table
+         * @param hit - true to take a card, false to stand
+         * @throws runtime_error if the table waits for nobody
+         */
+        void Decide(size_t table, bool hit);
+
+        /**
+         * @brief Get the number of rounds a table has played
+         *
+         * @param table
+         * @return uint64_t
+         */
+        uint64_t RoundsPlayed(size_t table) const;
+
+        /**
+         * @brief Get a table's players and their hands from the last round
+         *
+         * @param table
+         * @return vector<Player>&
+         */
+        vector<Player> &Players(size_t table);
+
+        /**
+         * @brief Get the number of tables
+         *
+         * @return size_t
+         */
+        size_t Tables() const;
+
+        /**
+         * @brief Get the number of times any table suspended, for a person or for more rounds
+         *
+         * @return uint64_t
+         */
+        uint64_t Suspensions() const;
+    };
+}
+
+#endif
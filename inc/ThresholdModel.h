@@ -0,0 +1,58 @@
+/**
+ * @file ThresholdModel.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Exact outcome probabilities of the threshold strategy under the infinite deck model,
+ *        computed from the Markov chain of (hard points, Aces) hand states instead of by
+ *        simulation. Hands are scored as Player scores them.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <vector>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief ThresholdModel answers what-if questions about threshold players when every card is
+     *        drawn with replacement, as from an InfiniteDeck. Seats are then independent, so the
+     *        final score distribution of each seat depends only on its threshold.
+     */
+    class ThresholdModel
+    {
+    public:
+        /// @brief Highest final score a threshold player can reach, 20 plus a ten
+        static const int MaxScore = 30;
+
+        /**
+         * @brief Get the probability of each final score 0 - MaxScore for a threshold
+         *
+         * @param threshold - 1 - 21
+         * @return vector<double> - MaxScore + 1 probabilities that sum to 1
+         * @throws runtime_error if the threshold is out of range
+         */
+        static vector<double> FinalScores(int threshold);
+
+        /**
+         * @brief Get the probability of going over 21 with a threshold
+         *
+         * @param threshold - 1 - 21
+         * @return double
+         */
+        static double BustProbability(int threshold);
+
+        /**
+         * @brief Get the probability of each seat winning a round, where a tie for the highest
+         *        score of 21 or less is a win for every tied seat, as in SortPlayers
+         *
+         * @param thresholds - threshold of each seat
+         * @return vector<double> - one probability per seat
+         */
+        static vector<double> WinProbabilities(const vector<int> &thresholds);
+    };
+}
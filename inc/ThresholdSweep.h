@@ -0,0 +1,187 @@
+/**
+ * @file ThresholdSweep.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Finds what every threshold 1 - 21 would do from one walk through a shoe, and a study
+ *        that plays a round at every threshold from each shoe at about the cost of one.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Round.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /// @brief Highest threshold a seat can play
+    const int MaxThreshold = 21;
+
+    /**
+     * @brief What a seat starting at one offset of a shoe ends with for every threshold,
+     *        indexed by threshold, entry 0 unused
+     */
+    struct ThresholdSweep
+    {
+        /// @brief Final score at each threshold
+        uint8_t score[MaxThreshold + 1];
+        /// @brief Cards taken at each threshold
+        uint8_t cards[MaxThreshold + 1];
+        /// @brief Bit t is set when threshold t busts
+        uint32_t busted;
+        /// @brief Bit t is set when the shoe ran out before threshold t stopped
+        uint32_t overDealt;
+    };
+
+    /**
+     * @brief Walk the shoe once from first the way PlayRound deals a seat. Drawing stops at the
+     *        first score at or above the threshold, so a threshold stops at the first card that
+     *        lifts the best score seen so far up to it: each new best score settles every
+     *        threshold between the old best and itself. Hands are scored as Player scores
+     *        them, so a card that turns the Aces to 1 can lower the score, for example A, 9
+     *        then 5 goes from 20 to 15; every threshold above the best is still drawing then,
+     *        so a lower score settles nothing. The walk ends at 21 or a bust.
+     *
+     * @param shoe - card codes, the first code is dealt first
+     * @param shoeSize - number of codes in shoe, the last one is never dealt
+     * @param first - offset of the seat's first card
+     * @param sweep - outcome of every threshold
+     */
+    void SweepThresholds(const uint8_t *shoe, int shoeSize, int first, ThresholdSweep &sweep);
+
+    /**
+     * @brief ThresholdStudy plays a round at every threshold from each shoe, every seat using
+     *        the same threshold. Seat 1 always starts at the top, and a later seat starts where
+     *        the one before stopped, which varies with the threshold but only over a few
+     *        offsets. Each offset is swept once per shoe and shared by every threshold that
+     *        reaches it. Results are plain counters per threshold and seat, so adding 21
+     *        rounds costs little more than dealing them.
+     */
+    class ThresholdStudy
+    {
+    public:
+        /// @brief Highest score a threshold player can reach, 20 plus a ten
+        static const int MaxScore = 30;
+
+    private:
+        /// @brief Number of seats
+        int _seats;
+        /// @brief Rounds of each threshold, index threshold - 1
+        vector<uint64_t> _rounds;
+        /// @brief Rounds each threshold could not finish, index threshold - 1
+        vector<uint64_t> _overDealt;
+        /// @brief Wins, [threshold - 1][seat]
+        vector<uint64_t> _wins;
+        /// @brief Busts, [threshold - 1][seat]
+        vector<uint64_t> _busts;
+        /// @brief Count of each final score, [threshold - 1][seat][score]
+        vector<uint64_t> _scores;
+        /// @brief Sweep of each offset of the current shoe
+        vector<ThresholdSweep> _sweeps;
+        /// @brief Shoe an offset was last swept for
+        vector<uint64_t> _sweptFor;
+        /// @brief Shoes added
+        uint64_t _shoes;
+        /// @brief Distinct offsets swept
+        uint64_t _sweepCount;
+        /// @brief Results of one round, one per seat
+        vector<SeatResult> _results;
+
+    public:
+        /**
+         * @brief Construct an empty study
+         *
+         * @param seats
+         * @throws runtime_error for fewer than one seat
+         */
+        explicit ThresholdStudy(int seats);
+
+        /**
+         * @brief Play one round at every threshold from the same shoe
+         *
+         * @param shoe - card codes
+         * @param shoeSize - number of codes in shoe
+         */
+        void AddShoe(const uint8_t *shoe, int shoeSize);
+
+        /**
+         * @brief Add a round played some other way, for example by PlayRound
+         *
+         * @param threshold - threshold every seat played, 1 - 21
+         * @param results - one SeatResult per seat, winners marked
+         */
+        void AddRound(int threshold, const SeatResult *results);
+
+        /**
+         * @brief Get the number of rounds of a threshold
+         *
+         * @param threshold - 1 - 21
+         * @return uint64_t
+         */
+        uint64_t Rounds(int threshold) const;
+
+        /**
+         * @brief Get the wins of a seat at a threshold, ties count for every tied seat
+         *
+         * @param threshold - 1 - 21
+         * @param seat
+         * @return uint64_t
+         */
+        uint64_t Wins(int threshold, int seat) const;
+
+        /**
+         * @brief Get the busts of a seat at a threshold
+         *
+         * @param threshold - 1 - 21
+         * @param seat
+         * @return uint64_t
+         */
+        uint64_t Busts(int threshold, int seat) const;
+
+        /**
+         * @brief Get how many times a seat finished with a score at a threshold
+         *
+         * @param threshold - 1 - 21
+         * @param seat
+         * @param score - 0 - MaxScore
+         * @return uint64_t
+         */
+        uint64_t ScoreCount(int threshold, int seat, int score) const;
+
+        /**
+         * @brief Get the mean final score of a seat at a threshold
+         *
+         * @param threshold - 1 - 21
+         * @param seat
+         * @return double
+         */
+        double MeanScore(int threshold, int seat) const;
+
+        /**
+         * @brief Get the rounds a threshold could not finish, which are left out of its counts
+         *
+         * @param threshold - 1 - 21
+         * @return uint64_t
+         */
+        uint64_t OverDealt(int threshold) const;
+
+        /**
+         * @brief Get the number of shoes added
+         *
+         * @return uint64_t
+         */
+        uint64_t Shoes() const;
+
+        /**
+         * @brief Get the number of walks through a shoe, for all thresholds and seats
+         *
+         * @return uint64_t
+         */
+        uint64_t Sweeps() const;
+    };
+}
@@ -0,0 +1,179 @@
+/**
+ * @file Tournament.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Header file for the Tournament class, a multi-round elimination bracket: every round
+ *        many tables play at once, only the winners of each table go on, and they are seated
+ *        at new tables for the next round.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Deck.h>
+#include <PlayerPool.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief How a tournament is set up
+     */
+    struct TournamentConfig
+    {
+        /// @brief Players entering the first round
+        uint64_t entrants = 1000;
+        /// @brief Most players at one table, 2 - MaxSeatsPerTable
+        int seatsPerTable = 6;
+        /// @brief Thresholds given to the entrants in turn
+        vector<int> thresholds = {17};
+        /// @brief Seed of the decks and seatings
+        uint64_t seed = 1;
+        /// @brief Threads playing the tables of a round, 0 for one per core
+        int threads = 0;
+    };
+
+    /**
+     * @brief What one round of a tournament did
+     */
+    struct TournamentRound
+    {
+        /// @brief Players seated
+        uint64_t players = 0;
+        /// @brief Tables played
+        uint64_t tables = 0;
+        /// @brief Tables dealt again because every seat busted or, rarely, the deck ran out
+        uint64_t redeals = 0;
+        /// @brief Players going on to the next round
+        uint64_t survivors = 0;
+        /// @brief Time the round took
+        double seconds = 0;
+    };
+
+    /**
+     * @brief Tournament makes every entrant once, from a PlayerPool, and keeps them for the
+     *        whole bracket: between rounds a player's hand is emptied with EmptyHand, never
+     *        rebuilt. A round shuffles the survivors, seats them at as few tables as hold them
+     *        with table sizes differing by at most one, and plays the tables on several threads,
+     *        each thread reusing one Deck. A one deck hand fits in the room every PooledPlayer
+     *        has from the start, so the threads never grow hands from the shared pool.
+     *        A table's deck depends only on the seed, round and
+     *        table, and survivors are collected in seat order after the threads finish, so the
+     *        bracket is the same on any number of threads.
+     *
+     *        Every non-busted seat with the table's best score goes on, ties included. A table
+     *        where every seat busts is dealt again. Once the survivors fit at one table, that
+     *        final table is played and its winners are the champions.
+     */
+    class Tournament
+    {
+    public:
+        /// @brief Most seats a table may have, so a round nearly always fits in one deck
+        static const int MaxSeatsPerTable = 8;
+
+    private:
+        /// @brief Setup of the tournament
+        TournamentConfig _config;
+        /// @brief Every entrant, in the order made
+        PlayerPool _pool;
+        /// @brief Rounds each entrant has won
+        vector<uint32_t> _roundsWon;
+        /// @brief Entrants still in, in seat order of the last round
+        vector<uint32_t> _survivors;
+        /// @brief Survivors of the round being played, by seat
+        vector<uint8_t> _advances;
+        /// @brief Every round played
+        vector<TournamentRound> _rounds;
+        /// @brief True once the final table has played
+        bool _finished;
+
+        /**
+         * @brief Deal one table until at least one seat does not bust, marking winners
+         *
+         * @param deck - deck reused by the calling thread
+         * @param first - first seat of the table in _survivors
+         * @param seats - seats at the table
+         * @param table - index of the table in the round
+         * @return uint64_t - times the table was dealt again
+         */
+        uint64_t playTable(Deck &deck, size_t first, int seats, uint64_t table);
+
+    public:
+        /**
+         * @brief Construct a Tournament, making every entrant
+         *
+         * @param config
+         * @throws runtime_error for no entrants, a table size out of range or a bad threshold
+         */
+        explicit Tournament(const TournamentConfig &config);
+
+        /**
+         * @brief Play one round of the bracket
+         *
+         * @return bool - false when the tournament had already finished
+         */
+        bool PlayRound();
+
+        /**
+         * @brief Play rounds until the final table has played
+         *
+         */
+        void Run();
+
+        /**
+         * @brief Get whether the final table has played
+         *
+         * @return bool
+         */
+        bool Finished() const;
+
+        /**
+         * @brief Get the entrants still in, the champions once finished
+         *
+         * @return const vector<uint32_t>& - entrant indices
+         */
+        const vector<uint32_t> &Survivors() const;
+
+        /**
+         * @brief Get every round played
+         *
+         * @return const vector<TournamentRound>&
+         */
+        const vector<TournamentRound> &Rounds() const;
+
+        /**
+         * @brief Get the number of entrants
+         *
+         * @return size_t
+         */
+        size_t Entrants() const;
+
+        /**
+         * @brief Get an entrant, with the hand of the last round it played
+         *
+         * @param index
+         * @return PooledPlayer&
+         */
+        PooledPlayer &Entrant(size_t index);
+
+        /**
+         * @brief Get the rounds an entrant won
+         *
+         * @param index
+         * @return uint32_t
+         */
+        uint32_t RoundsWon(size_t index) const;
+
+        /**
+         * @brief Get the bytes the entrants' pool has taken from the heap
+         *
+         * @return size_t
+         */
+        size_t BytesReserved() const;
+    };
+}
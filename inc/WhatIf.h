@@ -0,0 +1,159 @@
+/**
+ * @file WhatIf.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief A record of a round played by PlayBlackJack, and WhatIfRound, which answers "what if
+ *        this seat had played another threshold" from the record without dealing again.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Deck.h>
+
+using namespace std;
+
+namespace chants
+{
+
+    /**
+     * @brief One seat of a recorded round
+     */
+    struct RecordedSeat
+    {
+        /// @brief Threshold the seat played
+        int threshold;
+        /// @brief Offset in the recorded order of the seat's first card, its cut point
+        int first;
+        /// @brief Cards dealt to the seat
+        int cards;
+        /// @brief Final score, scored the way Player scores
+        int score;
+    };
+
+    /**
+     * @brief The card order of a round and where each seat's cards were cut from it.
+     *        Construct it from the deck before the round and pass it to PlayBlackJack.
+     */
+    struct RoundRecord
+    {
+        /// @brief Card codes of the deck from its top when the round started, dealt or not
+        vector<uint8_t> order;
+        /// @brief Seats in the order they were dealt
+        vector<RecordedSeat> seats;
+
+        /**
+         * @brief Copy the order of the cards left in a deck, without dealing any
+         *
+         * @param deck - deck the round is about to be dealt from
+         */
+        explicit RoundRecord(Deck &deck);
+
+        /**
+         * @brief Record a seat that has finished drawing, called by PlayBlackJack
+         *
+         * @param threshold
+         * @param first - offset of the seat's first card
+         * @param cards - cards dealt to the seat
+         * @param score
+         */
+        void AddSeat(int threshold, int first, int cards, int score);
+    };
+
+    /**
+     * @brief WhatIfRound holds every seat's cut point and score. Seats share one deck, so a
+     *        threshold change moves the cards of the seat and of every seat after it, but only
+     *        until a seat starts at the same offset as before: from there on the round is
+     *        unchanged, so re-evaluation stops. Non-busted scores are kept in a histogram, so
+     *        the winning score is found without sorting the seats.
+     */
+    class WhatIfRound
+    {
+    private:
+        /// @brief Card codes from the top of the round's deck
+        vector<uint8_t> _order;
+        /// @brief Current state of every seat
+        vector<RecordedSeat> _seats;
+        /// @brief Seats with each score of 21 or less
+        int _scoreCounts[22];
+        /// @brief Highest score of 21 or less, refreshed from _scoreCounts after a change
+        int _bestScore;
+        /// @brief Seats evaluated by the last change, waiting to be applied
+        vector<RecordedSeat> _pending;
+
+        /**
+         * @brief Deal a seat from an offset the way PlayBlackJack does
+         *
+         * @param seat - threshold and first card set, cards and score filled in
+         * @return bool - false if the deck ran out
+         */
+        bool deal(RecordedSeat &seat) const;
+
+        /**
+         * @brief Set _bestScore from the histogram
+         */
+        void refreshBestScore();
+
+    public:
+        /**
+         * @brief Construct a WhatIfRound from a recorded round
+         *
+         * @param record
+         * @throws runtime_error if the record has no seats
+         */
+        explicit WhatIfRound(const RoundRecord &record);
+
+        /**
+         * @brief Change a seat's threshold and re-evaluate the seats it affects
+         *
+         * @param seat - 0 based
+         * @param threshold - 1 - 21
+         * @return int - seats re-evaluated, or -1 if the deck would run out, in which case
+         *               nothing changes
+         * @throws runtime_error if the threshold is out of range
+         */
+        int SetThreshold(int seat, int threshold);
+
+        /**
+         * @brief Get the number of seats
+         *
+         * @return int
+         */
+        int Seats() const;
+
+        /**
+         * @brief Get a seat as it would be now
+         *
+         * @param seat
+         * @return const RecordedSeat&
+         */
+        const RecordedSeat &Seat(int seat) const;
+
+        /**
+         * @brief Get whether a seat busted
+         *
+         * @param seat
+         * @return bool
+         */
+        bool IsBusted(int seat) const;
+
+        /**
+         * @brief Get whether a seat wins, as SortPlayers marks winners: every seat with the
+         *        highest score of 21 or less
+         *
+         * @param seat
+         * @return bool
+         */
+        bool IsWinner(int seat) const;
+
+        /**
+         * @brief Get the winning score
+         *
+         * @return int - 0 when every seat busted
+         */
+        int BestScore() const;
+    };
+}
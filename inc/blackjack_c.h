@@ -0,0 +1,138 @@
+/**
+ * @file blackjack_c.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Stable C interface of the blackjack engine, built as the blackjack_c shared library for
+ *        callers in other languages. An engine is an opaque handle; each call plays a batch of
+ *        rounds and writes the outcomes into arrays owned by the caller, so no memory changes
+ *        hands across the boundary and no callback runs per card.
+ *
+ *        Round r of an engine made with seed s deals the shoe of ShuffleKernel::ShuffleRound(s, r),
+ *        which with one deck is also Deck::Seeded(s, r), so results can be regenerated by the C++ tools.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(BJ_BUILDING)
+#define BJ_API __declspec(dllexport)
+#else
+#define BJ_API __declspec(dllimport)
+#endif
+#else
+#define BJ_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Version of this interface, raised only when existing calls change
+     */
+#define BJ_API_VERSION 1
+
+    /**
+     * @brief Status returned by every call that can fail
+     */
+    enum bj_status
+    {
+        /// @brief The call succeeded
+        BJ_OK = 0,
+        /// @brief A pointer was null or a count, threshold or deck number was out of range
+        BJ_ERROR_ARGUMENT = -1,
+        /// @brief The shoe ran out of cards during a round; outputs before that round are written
+        BJ_ERROR_OVER_DEALT = -2,
+        /// @brief The engine could not be allocated
+        BJ_ERROR_MEMORY = -3,
+        /// @brief Any other failure inside the engine
+        BJ_ERROR_INTERNAL = -4
+    };
+
+    /**
+     * @brief Opaque engine handle, one table of seats with a seed. A handle may be used by one
+     *        thread at a time; use one handle per thread to play in parallel.
+     */
+    typedef struct bj_engine bj_engine;
+
+    /**
+     * @brief Get the interface version the library was built with
+     *
+     * @return int - BJ_API_VERSION
+     */
+    BJ_API int bj_api_version(void);
+
+    /**
+     * @brief Get a short description of a status
+     *
+     * @param status - a bj_status
+     * @return const char* - static string, never freed
+     */
+    BJ_API const char *bj_status_string(int status);
+
+    /**
+     * @brief Create an engine
+     *
+     * @param seed - seed of the run
+     * @param seats - number of seats, 1 or more
+     * @param thresholds - threshold of each seat, 1 - 21, copied into the engine
+     * @param decks - decks per shoe, 1 - 8
+     * @param engine - receives the handle, which bj_engine_destroy releases
+     * @return int - BJ_OK, BJ_ERROR_ARGUMENT or BJ_ERROR_MEMORY
+     */
+    BJ_API int bj_engine_create(uint64_t seed, int seats, const int *thresholds, int decks, bj_engine **engine);
+
+    /**
+     * @brief Release an engine, null is ignored
+     *
+     * @param engine
+     */
+    BJ_API void bj_engine_destroy(bj_engine *engine);
+
+    /**
+     * @brief Get the number of seats of an engine
+     *
+     * @param engine
+     * @return int - seats, or BJ_ERROR_ARGUMENT for a null engine
+     */
+    BJ_API int bj_engine_seats(const bj_engine *engine);
+
+    /**
+     * @brief Play rounds first_round to first_round + rounds - 1. Each output array holds
+     *        rounds * seats entries, round by round and seat by seat within a round; pass null
+     *        for any output that is not needed. Nothing is allocated.
+     *
+     * @param engine
+     * @param first_round - index of the first round
+     * @param rounds - number of rounds
+     * @param scores - final score of each seat, scored as Player scores so every Ace counts
+     *                 as 1 once a hand goes over 21, or null
+     * @param winners - 1 when the seat won the round, ties all win, or null
+     * @param busted - 1 when the seat went over 21, or null
+     * @return int - BJ_OK, BJ_ERROR_ARGUMENT or BJ_ERROR_OVER_DEALT
+     */
+    BJ_API int bj_play_rounds(bj_engine *engine, uint64_t first_round, uint64_t rounds,
+                              int32_t *scores, uint8_t *winners, uint8_t *busted);
+
+    /**
+     * @brief Play rounds like bj_play_rounds but only count each seat's wins and busts,
+     *        for callers that want totals over a very large batch
+     *
+     * @param engine
+     * @param first_round - index of the first round
+     * @param rounds - number of rounds
+     * @param wins - wins of each seat, seats entries, added to
+     * @param busts - busts of each seat, seats entries, added to, or null
+     * @return int - BJ_OK, BJ_ERROR_ARGUMENT or BJ_ERROR_OVER_DEALT
+     */
+    BJ_API int bj_count_rounds(bj_engine *engine, uint64_t first_round, uint64_t rounds,
+                               uint64_t *wins, uint64_t *busts);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,320 @@
+/**
+ * @file BankrollSimulator.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief BankrollSimulator implementation, blocks of sessions advanced side by side.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <BankrollSimulator.h>
+
+namespace chants
+{
+
+    const int BankrollSimulator::BlockPaths;
+
+    namespace
+    {
+        /// @brief Step of the SplitMix64 generator
+        const uint64_t GoldenGamma = 0x9E3779B97F4A7C15ull;
+
+        // SplitMix64 output for a state
+        inline uint64_t mix(uint64_t z)
+        {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // Results of one block of sessions, merged in block order so threads do not change them
+        struct BlockResult
+        {
+            RunningStats hourly;
+            RunningStats final;
+            uint64_t hands = 0;
+            uint64_t ruined = 0;
+        };
+    }
+
+    /**
+     * @brief Retrieves a drawdown by nearest rank.
+     *
+     * @param share Share of the sessions.
+     * @return double The drawdown, 0 when there are no sessions.
+     */
+    double SessionReport::DrawdownPercentile(double share) const
+    {
+        if (drawdowns.empty())
+            return 0;
+        double rank = ceil(share * drawdowns.size());
+        size_t index = rank < 1 ? 0 : min(drawdowns.size() - 1, static_cast<size_t>(rank) - 1);
+        return drawdowns[index];
+    }
+
+    /**
+     * @brief Construct a BankrollSimulator, building the alias table with Vose's method.
+     *
+     * @param outcomes Result of one hand in bet units.
+     * @param weights How often each outcome happens.
+     */
+    BankrollSimulator::BankrollSimulator(const vector<double> &outcomes, const vector<double> &weights)
+        : _outcomes(outcomes), _probabilities(outcomes.size()), _keep(outcomes.size()), _alias(outcomes), _mean(0), _variance(0), _floor(1.0)
+    {
+        if (outcomes.empty() || outcomes.size() != weights.size())
+            throw runtime_error("Outcomes and weights must be the same non-empty size");
+        double total = 0;
+        for (double weight : weights)
+        {
+            if (weight < 0)
+                throw runtime_error("Weights cannot be negative");
+            total += weight;
+        }
+        if (total <= 0)
+            throw runtime_error("Weights add up to nothing");
+
+        const size_t n = outcomes.size();
+        vector<double> scaled(n);
+        vector<size_t> small;
+        vector<size_t> large;
+        for (size_t i = 0; i < n; i++)
+        {
+            double p = weights[i] / total;
+            _probabilities[i] = p;
+            _mean += p * outcomes[i];
+            _variance += p * outcomes[i] * outcomes[i];
+            scaled[i] = p * n;
+            (scaled[i] < 1 ? small : large).push_back(i);
+        }
+        _variance -= _mean * _mean;
+
+        // A unit bet at least, more when a hand can lose more than its bet
+        for (size_t i = 0; i < n; i++)
+        {
+            if (_probabilities[i] > 0)
+                _floor = max(_floor, -outcomes[i]);
+        }
+
+        // An outcome left without a partner keeps itself, so its threshold never matters
+        fill(_keep.begin(), _keep.end(), numeric_limits<uint32_t>::max());
+        while (!small.empty() && !large.empty())
+        {
+            size_t less = small.back();
+            size_t more = large.back();
+            small.pop_back();
+            _keep[less] = static_cast<uint32_t>(scaled[less] * 4294967296.0);
+            _alias[less] = outcomes[more];
+            scaled[more] -= 1 - scaled[less];
+            if (scaled[more] < 1)
+            {
+                large.pop_back();
+                small.push_back(more);
+            }
+        }
+    }
+
+    /**
+     * @brief Deals rounds at a table where every seat bets one unit from a bankroll that
+     *        never runs out, and counts each seat's result.
+     *
+     * @param rules Rules of the table.
+     * @param seats Seats at the table.
+     * @param rounds Rounds to deal.
+     * @param seed Seed of the shuffles.
+     * @return BankrollSimulator The simulator.
+     */
+    BankrollSimulator BankrollSimulator::FromTable(const DealerRules &rules, int seats, uint64_t rounds, uint64_t seed)
+    {
+        DealerTable table(rules, seed);
+        for (int seat = 0; seat < seats; seat++)
+            table.Join(1e15);
+        vector<double> bets(seats, 1.0);
+
+        vector<double> outcomes;
+        vector<double> weights;
+        for (uint64_t round = 0; round < rounds; round++)
+        {
+            table.PlayRound(bets.data());
+            for (int seat = 0; seat < seats; seat++)
+            {
+                double net = table.Net(seat);
+                size_t i = 0;
+                while (i < outcomes.size() && fabs(outcomes[i] - net) > 1e-9)
+                    i++;
+                if (i == outcomes.size())
+                {
+                    outcomes.push_back(net);
+                    weights.push_back(0);
+                }
+                weights[i]++;
+            }
+        }
+        return BankrollSimulator(outcomes, weights);
+    }
+
+    /**
+     * @brief Retrieves the mean of one hand.
+     *
+     * @return double The mean.
+     */
+    double BankrollSimulator::MeanPerHand() const
+    {
+        return _mean;
+    }
+
+    /**
+     * @brief Retrieves the variance of one hand.
+     *
+     * @return double The variance.
+     */
+    double BankrollSimulator::VariancePerHand() const
+    {
+        return _variance;
+    }
+
+    /**
+     * @brief Retrieves the smallest bankroll that still plays a hand.
+     *
+     * @return double The worst loss of a hand, at least one unit.
+     */
+    double BankrollSimulator::Floor() const
+    {
+        return _floor;
+    }
+
+    /**
+     * @brief Retrieves the outcomes.
+     *
+     * @return const vector<double>& Distinct outcomes.
+     */
+    const vector<double> &BankrollSimulator::Outcomes() const
+    {
+        return _outcomes;
+    }
+
+    /**
+     * @brief Retrieves the probabilities.
+     *
+     * @return const vector<double>& Probability of each outcome.
+     */
+    const vector<double> &BankrollSimulator::Probabilities() const
+    {
+        return _probabilities;
+    }
+
+    /**
+     * @brief Plays every session hand by hand, a block of sessions at a time. Within a block
+     *        each hand is a branch-free pass over the lanes: draw, settle if still playing,
+     *        raise the high and the drawdown. Threads take blocks from a shared counter.
+     *        A session plays a hand only while it can cover the worst result a hand can have,
+     *        doubles and splits included, so no bankroll goes below zero.
+     *
+     * @param config The sessions.
+     * @param threads Number of threads, 0 for one per core.
+     * @return SessionReport The report.
+     */
+    SessionReport BankrollSimulator::Run(const SessionConfig &config, int threads) const
+    {
+        if (config.hours < 0 || config.handsPerHour < 0)
+            throw runtime_error("Sessions cannot be negative in length");
+
+        const uint64_t blocks = (config.paths + BlockPaths - 1) / BlockPaths;
+        if (threads <= 0)
+            threads = max(1, static_cast<int>(thread::hardware_concurrency()));
+        threads = static_cast<int>(min<uint64_t>(threads, max<uint64_t>(blocks, 1)));
+
+        SessionReport report;
+        report.paths = config.paths;
+        report.drawdowns.resize(config.paths);
+        vector<BlockResult> results(blocks);
+        atomic<uint64_t> next(0);
+
+        const uint64_t n = _outcomes.size();
+        const double *outcomes = _outcomes.data();
+        const uint32_t *keep = _keep.data();
+        const double *alias = _alias.data();
+
+        auto work = [&]()
+        {
+            double bankroll[BlockPaths];
+            double peak[BlockPaths];
+            double drawdown[BlockPaths];
+            double hourStart[BlockPaths];
+            uint64_t state[BlockPaths];
+            uint32_t played[BlockPaths];
+
+            for (uint64_t block = next++; block < blocks; block = next++)
+            {
+                const uint64_t first = block * BlockPaths;
+                const int lanes = static_cast<int>(min<uint64_t>(BlockPaths, config.paths - first));
+                for (int lane = 0; lane < lanes; lane++)
+                {
+                    bankroll[lane] = config.bankroll;
+                    peak[lane] = config.bankroll;
+                    drawdown[lane] = 0;
+                    state[lane] = mix(config.seed ^ mix(first + lane + 1));
+                    played[lane] = 0;
+                }
+
+                BlockResult &result = results[block];
+                for (int hour = 0; hour < config.hours; hour++)
+                {
+                    for (int lane = 0; lane < lanes; lane++)
+                        hourStart[lane] = bankroll[lane];
+
+                    for (int hand = 0; hand < config.handsPerHour; hand++)
+                    {
+                        for (int lane = 0; lane < lanes; lane++)
+                        {
+                            state[lane] += GoldenGamma;
+                            uint64_t random = mix(state[lane]);
+                            uint64_t bucket = ((random >> 32) * n) >> 32;
+                            double outcome = static_cast<uint32_t>(random) < keep[bucket] ? outcomes[bucket] : alias[bucket];
+                            bool live = bankroll[lane] >= _floor;
+                            bankroll[lane] += live ? outcome : 0.0;
+                            played[lane] += live;
+                            peak[lane] = max(peak[lane], bankroll[lane]);
+                            drawdown[lane] = max(drawdown[lane], peak[lane] - bankroll[lane]);
+                        }
+                    }
+
+                    for (int lane = 0; lane < lanes; lane++)
+                        result.hourly.Add(bankroll[lane] - hourStart[lane]);
+                }
+
+                for (int lane = 0; lane < lanes; lane++)
+                {
+                    result.final.Add(bankroll[lane]);
+                    result.hands += played[lane];
+                    result.ruined += bankroll[lane] < _floor;
+                    report.drawdowns[first + lane] = drawdown[lane];
+                }
+            }
+        };
+
+        vector<thread> workers;
+        for (int t = 1; t < threads; t++)
+            workers.push_back(thread(work));
+        work();
+        for (thread &worker : workers)
+            worker.join();
+
+        uint64_t ruined = 0;
+        for (const BlockResult &result : results)
+        {
+            report.hourly.Merge(result.hourly);
+            report.final.Merge(result.final);
+            report.hands += result.hands;
+            ruined += result.ruined;
+        }
+        report.ruin = config.paths == 0 ? 0 : static_cast<double>(ruined) / config.paths;
+        sort(report.drawdowns.begin(), report.drawdowns.end());
+        return report;
+    }
+}
@@ -30,7 +30,7 @@ namespace chants
                 throw std::runtime_error("Suit value out of range. Must be 1 - 4");
 
             _value = value;
-            convertValueToString(value);
+            _rank = value;
 
             // if Jack, Queen, or King, set to 10
             if (value > 10)
@@ -44,7 +44,6 @@ namespace chants
             }
 
             _suit = suit;
-            convertSuitToString(suit);
 
             this->isFaceUp = isFaceUp;
         }
@@ -64,19 +63,39 @@ namespace chants
         return _value;
     }
 
+    /**
+     * @brief return the rank the card was made with
+     *
+     * @return int
+     */
+    int Card::GetRank() const
+    {
+        return _rank;
+    }
+
+    /**
+     * @brief return the suit of the card
+     *
+     * @return int
+     */
+    int Card::GetSuit() const
+    {
+        return _suit;
+    }
+
     /**
      * @brief converts the card integer to a string representation,
      *          example: 1 = Ace, 11 = Jack, 12 = Queen, 13 = King
      *
      * @param val - number 1 - 13
+     * @return string
      */
-    void Card::convertValueToString(int val)
+    string Card::convertValueToString(int val)
     {
         switch (val)
         {
         case 1:
-            _strValue = "ACE";
-            break;
+            return "ACE";
         case 2:
         case 3:
         case 4:
@@ -86,17 +105,13 @@ namespace chants
         case 8:
         case 9:
         case 10:
-            _strValue = std::to_string(val);
-            break;
+            return std::to_string(val);
         case 11:
-            _strValue = "JACK";
-            break;
+            return "JACK";
         case 12:
-            _strValue = "QUEEN";
-            break;
+            return "QUEEN";
         case 13:
-            _strValue = "KING";
-            break;
+            return "KING";
         default:
             throw "Card value must be between 1 and 13.";
         }
@@ -107,23 +122,20 @@ namespace chants
      *          example: 1 = Clubs, 2 = Diamonds, 3 = Hearts, 4 = Spades
      *
      * @param val - number 1 - 4
+     * @return string
      */
-    void Card::convertSuitToString(int suit)
+    string Card::convertSuitToString(int suit)
     {
         switch (suit)
         {
         case 1:
-            _strSuit = "CLUBS";
-            break;
+            return "CLUBS";
         case 2:
-            _strSuit = "DIAMONDS";
-            break;
+            return "DIAMONDS";
         case 3:
-            _strSuit = "HEARTS";
-            break;
+            return "HEARTS";
         case 4:
-            _strSuit = "SPADES";
-            break;
+            return "SPADES";
         default:
             throw "Suit must be a value between 1 and 4.";
         }
@@ -138,7 +150,7 @@ namespace chants
     {
         std::string temp = "";
         if (isFaceUp)
-            temp = _strValue + " " + _strSuit;
+            temp = convertValueToString(_rank) + " " + convertSuitToString(_suit);
         else
             temp = "Face-down";
         return temp;
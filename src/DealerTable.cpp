@@ -0,0 +1,329 @@
+/**
+ * @file DealerTable.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief DealerTable implementation, rounds against a dealer played by basic strategy.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <stdexcept>
+#include <BasicStrategy.h>
+#include <DealerTable.h>
+#include <ShuffleKernel.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Cards kept back for each seat and the dealer, so a round never runs dry
+        const int CardsPerHandReserve = 10;
+
+        // Add points to a hand, turning soft Aces into 1 while it would bust
+        void addPoints(DealerTable::Hand &hand, int points)
+        {
+            if (hand.cards == 0)
+                hand.firstPoints = points;
+            hand.total += points;
+            hand.cards++;
+            if (points == 11)
+                hand.softAces++;
+            while (hand.total > 21 && hand.softAces > 0)
+            {
+                hand.total -= 10;
+                hand.softAces--;
+            }
+        }
+
+        // Add a card to a hand
+        void addCard(DealerTable::Hand &hand, uint8_t code)
+        {
+            addPoints(hand, CodeToPoints(code));
+        }
+
+        // An empty hand with a bet on it
+        DealerTable::Hand emptyHand(double bet, bool fromSplit)
+        {
+            DealerTable::Hand hand = {0, 0, 0, 0, bet, fromSplit};
+            return hand;
+        }
+
+        // True for the first two cards of a hand adding up to 21
+        bool isNatural(const DealerTable::Hand &hand)
+        {
+            return !hand.fromSplit && hand.cards == 2 && hand.total == 21;
+        }
+    }
+
+    /**
+     * @brief Construct a DealerTable, the first round shuffles the first shoe.
+     *
+     * @param rules Rules of the table.
+     * @param seed Seed of the shuffles.
+     */
+    DealerTable::DealerTable(const DealerRules &rules, uint64_t seed)
+        : _rules(rules), _seed(seed), _stacked(false), _next(0), _shoes(0), _rounds(0)
+    {
+        if (rules.decks < 1 || rules.penetration <= 0 || rules.penetration > 1 || rules.blackjackPays <= 0)
+            throw runtime_error("Invalid table rules");
+        _shoe.resize(rules.decks * CardsPerDeck);
+        _next = static_cast<int>(_shoe.size());
+    }
+
+    /**
+     * @brief Construct a DealerTable over a stacked shoe.
+     *
+     * @param rules Rules of the table, only the payouts and dealer rule are used.
+     * @param cards Card codes in dealing order.
+     * @param count Number of cards.
+     */
+    DealerTable::DealerTable(const DealerRules &rules, const uint8_t *cards, int count)
+        : _rules(rules), _seed(0), _stacked(true), _shoe(cards, cards + count), _next(0), _shoes(0), _rounds(0)
+    {
+    }
+
+    /**
+     * @brief Deals the next card.
+     *
+     * @return uint8_t The card code.
+     */
+    uint8_t DealerTable::deal()
+    {
+        if (_next >= static_cast<int>(_shoe.size()))
+            throw runtime_error("The shoe is out of cards");
+        return _shoe[_next++];
+    }
+
+    /**
+     * @brief Reshuffles at the cut card. The cut moves forward when the table is so full that
+     *        the rest of the shoe might not finish a round.
+     */
+    void DealerTable::shuffleIfNeeded()
+    {
+        if (_stacked)
+            return;
+        const int cards = static_cast<int>(_shoe.size());
+        const int reserve = max(static_cast<int>(cards * (1 - _rules.penetration)),
+                                CardsPerHandReserve * (Seats() + 1));
+        if (reserve >= cards)
+            throw runtime_error("The shoe is too small for the table");
+        if (cards - _next < reserve)
+        {
+            ShuffleKernel::ShuffleRound(_seed, _shoes++, _shoe.data(), _rules.decks);
+            _next = 0;
+        }
+    }
+
+    /**
+     * @brief Plays a hand by basic strategy until it stands, busts or reaches 21. Doubles and
+     *        splits fall back to the next best play when the bankroll cannot cover them.
+     *
+     * @param seat The seat.
+     * @param hand Index of the hand in _hands.
+     * @param upcard Points of the dealer's upcard.
+     */
+    void DealerTable::playHand(int seat, int hand, int upcard)
+    {
+        for (;;)
+        {
+            Hand &current = _hands[hand];
+            if (current.total >= 21)
+                return;
+
+            double staked = _hands[2 * seat].bet + (_handCounts[seat] == 2 ? _hands[2 * seat + 1].bet : 0);
+            bool affordable = staked + current.bet <= _bankrolls[seat];
+            bool canDouble = current.cards == 2 && (!current.fromSplit || _rules.doubleAfterSplit) && affordable;
+            // Two cards are a pair when the second is worth the first, a pair of Aces is soft 12
+            bool pair = current.cards == 2 && !current.fromSplit && affordable &&
+                        (current.firstPoints == 11 ? current.total == 12 : current.total == 2 * current.firstPoints);
+
+            StrategyAction action = BasicStrategyAction(current.total, current.softAces > 0, upcard, canDouble, pair);
+            if (action == StrategyStand)
+                return;
+            if (action == StrategyHit)
+            {
+                addCard(current, deal());
+                continue;
+            }
+            if (action == StrategyDouble)
+            {
+                current.bet *= 2;
+                addCard(current, deal());
+                return;
+            }
+
+            // Split once: each half takes a card, and split Aces stop there
+            int points = current.firstPoints;
+            Hand &second = _hands[hand + 1];
+            second = emptyHand(current.bet, true);
+            current = emptyHand(current.bet, true);
+            _handCounts[seat] = 2;
+            addPoints(current, points);
+            addPoints(second, points);
+            addCard(current, deal());
+            addCard(second, deal());
+            if (points == 11)
+                return;
+            playHand(seat, hand, upcard);
+            playHand(seat, hand + 1, upcard);
+            return;
+        }
+    }
+
+    /**
+     * @brief Seats a player with room for a split hand.
+     *
+     * @param bankroll Money to start with.
+     * @return int Index of the seat.
+     */
+    int DealerTable::Join(double bankroll)
+    {
+        _bankrolls.push_back(bankroll);
+        _net.push_back(0);
+        _handCounts.push_back(0);
+        _hands.resize(_bankrolls.size() * 2, emptyHand(0, false));
+        return static_cast<int>(_bankrolls.size()) - 1;
+    }
+
+    /**
+     * @brief Retrieves the number of seats.
+     *
+     * @return int Number of seats.
+     */
+    int DealerTable::Seats() const
+    {
+        return static_cast<int>(_bankrolls.size());
+    }
+
+    /**
+     * @brief Plays a round: two cards each with the dealer's second card face down, the dealer
+     *        peeks on an Ace or ten, the seats play, the dealer draws to 17, and every hand is
+     *        settled into its seat's bankroll. A natural pays blackjackPays unless the dealer
+     *        has one too.
+     *
+     * @param bets Bet of each seat.
+     * @return uint64_t Index of the round.
+     */
+    uint64_t DealerTable::PlayRound(const double *bets)
+    {
+        shuffleIfNeeded();
+        const int seats = Seats();
+        bool anyone = false;
+        for (int seat = 0; seat < seats; seat++)
+        {
+            _net[seat] = 0;
+            _handCounts[seat] = 0;
+            if (bets[seat] > 0 && bets[seat] <= _bankrolls[seat])
+            {
+                _hands[2 * seat] = emptyHand(bets[seat], false);
+                _handCounts[seat] = 1;
+                anyone = true;
+            }
+        }
+        if (!anyone)
+            return _rounds++;
+
+        Hand dealer = emptyHand(0, false);
+        for (int card = 0; card < 2; card++)
+        {
+            for (int seat = 0; seat < seats; seat++)
+            {
+                if (_handCounts[seat] > 0)
+                    addCard(_hands[2 * seat], deal());
+            }
+            addCard(dealer, deal());
+        }
+        const int upcard = dealer.firstPoints;
+        const bool dealerNatural = dealer.total == 21;
+
+        bool live = false;
+        if (!dealerNatural)
+        {
+            for (int seat = 0; seat < seats; seat++)
+            {
+                if (_handCounts[seat] == 0 || isNatural(_hands[2 * seat]))
+                    continue;
+                playHand(seat, 2 * seat, upcard);
+                for (int hand = 0; hand < _handCounts[seat]; hand++)
+                    live = live || _hands[2 * seat + hand].total <= 21;
+            }
+        }
+        while (live && (dealer.total < 17 || (dealer.total == 17 && dealer.softAces > 0 && _rules.dealerHitsSoft17)))
+        {
+            addCard(dealer, deal());
+        }
+
+        for (int seat = 0; seat < seats; seat++)
+        {
+            for (int index = 0; index < _handCounts[seat]; index++)
+            {
+                const Hand &hand = _hands[2 * seat + index];
+                if (isNatural(hand))
+                    _net[seat] += dealerNatural ? 0 : hand.bet * _rules.blackjackPays;
+                else if (dealerNatural || hand.total > 21)
+                    _net[seat] -= hand.bet;
+                else if (dealer.total > 21 || hand.total > dealer.total)
+                    _net[seat] += hand.bet;
+                else if (hand.total < dealer.total)
+                    _net[seat] -= hand.bet;
+            }
+            _bankrolls[seat] += _net[seat];
+        }
+        return _rounds++;
+    }
+
+    /**
+     * @brief Retrieves a bankroll.
+     *
+     * @param seat The seat.
+     * @return double The bankroll.
+     */
+    double DealerTable::Bankroll(int seat) const
+    {
+        return _bankrolls[seat];
+    }
+
+    /**
+     * @brief Retrieves the result of the last round.
+     *
+     * @param seat The seat.
+     * @return double Money won, negative when lost.
+     */
+    double DealerTable::Net(int seat) const
+    {
+        return _net[seat];
+    }
+
+    /**
+     * @brief Retrieves the hands played in the last round.
+     *
+     * @param seat The seat.
+     * @return int Number of hands.
+     */
+    int DealerTable::HandsPlayed(int seat) const
+    {
+        return _handCounts[seat];
+    }
+
+    /**
+     * @brief Retrieves the number of shoes shuffled.
+     *
+     * @return uint64_t Number of shoes.
+     */
+    uint64_t DealerTable::Shoes() const
+    {
+        return _shoes;
+    }
+
+    /**
+     * @brief Retrieves the rules.
+     *
+     * @return const DealerRules& The rules.
+     */
+    const DealerRules &DealerTable::Rules() const
+    {
+        return _rules;
+    }
+}
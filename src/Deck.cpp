@@ -7,7 +7,11 @@
  *
  */
 #include <iostream>
+#include <random>
+#include <stdexcept>
 #include <Deck.h>
+#include <CardCode.h>
+#include <Philox.h>
 
 namespace chants
 {
@@ -18,12 +22,13 @@ namespace chants
      * 
      * @param shuffle Indicates if the deck should be shuffled upon creation.
      */
-    Deck::Deck(bool shuffle)
+    Deck::Deck(bool shuffle) : _top(0)
     {
         if (shuffle)
         {
+            std::random_device device;
             buildDeck();
-            shuffleDeck();
+            shuffleDeck((static_cast<uint64_t>(device()) << 32) ^ device() ^ time(nullptr), 0);
         }
         else
         {
@@ -31,11 +36,53 @@ namespace chants
         }
     }
 
+    /**
+     * @brief Constructor of an empty deck, used by the factories.
+     */
+    Deck::Deck() : _top(0)
+    {
+    }
+
+    /**
+     * @brief Builds and shuffles the deck of one round of a seeded run.
+     *
+     * @param seed Seed of the run.
+     * @param round Index of the round.
+     * @return Deck The shuffled deck.
+     */
+    Deck Deck::Seeded(uint64_t seed, uint64_t round)
+    {
+        Deck seeded;
+        seeded.buildDeck();
+        seeded.shuffleDeck(seed, round);
+        return seeded;
+    }
+
+    /**
+     * @brief Copies an already shuffled sequence of card codes,
+     *        so a shoe from a ShuffleKernel batch can be played without reshuffling.
+     *
+     * @param cards Card codes, first code is dealt first.
+     * @param count Number of cards.
+     * @return Deck The deck holding the codes.
+     */
+    Deck Deck::FromCodes(const uint8_t *cards, int count)
+    {
+        Deck coded;
+        coded.deck.reserve(count);
+        for (int i = 0; i < count; i++)
+        {
+            coded.deck.push_back(Card(CodeToValue(cards[i]), CodeToSuit(cards[i]), false));
+        }
+        return coded;
+    }
+
     /**
      * @brief Builds a standard deck of 52 cards with 4 suits and 13 ranks each.
      */
     void Deck::buildDeck()
     {
+        deck.reserve(CardsPerDeck);
         for (int i = 1; i <= 4; i++)
         {
             for (int j = 1; j <= 13; j++)
@@ -47,21 +94,38 @@ namespace chants
     }
 
     /**
-     * @brief Shuffles the deck by randomly swapping cards multiple times for randomness.
+     * @brief Shuffles the deck with a Fisher-Yates shuffle drawing from the Philox stream of the round.
+     *        It gives the same order as ShuffleKernel::ShuffleRound for a one deck shoe.
+     *
+     * @param seed Seed of the run.
+     * @param round Index of the round.
      */
-    void Deck::shuffleDeck()
+    void Deck::shuffleDeck(uint64_t seed, uint64_t round)
     {
-        srand(time(nullptr));
-        for (int i = 0; i < 10000; i++)
+        PhiloxStream stream(seed, round);
+        for (uint32_t i = deck.size() - 1; i > 0; i--)
         {
-            int index1 = rand() % 52;
-            int index2 = rand() % 52;
-            Card tempCard = deck[index1];
-            deck[index1] = deck[index2];
-            deck[index2] = tempCard;
+            uint32_t j = stream.Bounded(i + 1);
+            Card tempCard = deck[i];
+            deck[i] = deck[j];
+            deck[j] = tempCard;
         }
     }
 
+    /**
+     * @brief Clears the deck, keeping its storage, then builds and shuffles it again.
+     *
+     * @param seed Seed of the run.
+     * @param round Index of the round.
+     */
+    void Deck::Reset(uint64_t seed, uint64_t round)
+    {
+        deck.clear();
+        _top = 0;
+        buildDeck();
+        shuffleDeck(seed, round);
+    }
+
     /**
      * @brief Retrieves the number of cards currently left in the deck.
      *
@@ -69,22 +133,21 @@ namespace chants
      */
     int Deck::CardsInDeck()
     {
-        return deck.size();
+        return deck.size() - _top;
     }
 
     /**
-     * @brief Deals a card from the top of the deck and removes it from the deck.
+     * @brief Deals a card from the top of the deck by moving the top index past it,
+     *        so no cards are moved.
      *
      * @return Card The dealt card from the deck.
      * @throws runtime_error if the deck is empty.
      */
     Card Deck::Deal()
     {
-        if (deck.size() > 1)
+        if (CardsInDeck() > 1)
         {
-            Card card = deck[0];
-            deck.erase(deck.begin());
-            return card;
+            return deck[_top++];
         }
         else
         {
@@ -92,6 +155,20 @@ namespace chants
         }
     }
 
+    /**
+     * @brief Returns a card below the top of the deck, leaving it in place.
+     *
+     * @param offset Position from the top, 0 is the next card dealt.
+     * @return Card The card.
+     * @throws out_of_range if the deck does not reach that far.
+     */
+    Card Deck::CardAt(int offset) const
+    {
+        if (offset < 0 || _top + offset >= static_cast<int>(deck.size()))
+            throw out_of_range("No card at that position of the deck.");
+        return deck[_top + offset];
+    }
+
     /**
      * @brief Returns a string representation of the entire deck, listing each card.
      *
@@ -100,9 +177,9 @@ namespace chants
     string Deck::ToString()
     {
         string temp = "";
-        for (Card card : deck)
+        for (size_t i = _top; i < deck.size(); i++)
         {
-            temp += card.ToString() + "\n";
+            temp += deck[i].ToString() + "\n";
         }
         return temp;
     }
@@ -0,0 +1,449 @@
+/**
+ * @file GameServer.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief GameServer class implementation, an epoll event loop per thread serving game tables.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <GameServer.h>
+#include <Table.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Longest request line accepted before the connection is closed
+        const size_t MaxLineLength = 4096;
+
+        /// @brief Bytes read from a socket per call
+        const size_t ReadChunk = 65536;
+
+        /// @brief Unsent reply bytes above which a connection is not read until its output drains
+        const size_t OutputHighWater = 1 << 20;
+
+        /**
+         * @brief One client connection and the tables it opened
+         */
+        struct Connection
+        {
+            int fd;
+            string input;
+            string output;
+            size_t sent;
+            /// @brief Set while too much output waits, requests are not read or handled until it drains
+            bool paused;
+            /// @brief Set by QUIT, the connection is closed once the replies before it are sent
+            bool quitting;
+            /// @brief Events the connection is registered for
+            uint32_t events;
+            vector<unique_ptr<Table>> tables;
+        };
+
+        // Handle one request line and append the reply to the connection's output
+        void handleLine(Connection &connection, const string &line, uint64_t seed, ServerStats &stats, bool &quit)
+        {
+            istringstream request(line);
+            string command;
+            request >> command;
+            stats.requests++;
+
+            try
+            {
+                if (command == "OPEN")
+                {
+                    int seats = 0;
+                    int threshold = 0;
+                    if (!(request >> seats >> threshold) || seats < 1 || seats > 64)
+                        throw runtime_error("usage OPEN seats threshold");
+
+                    unique_ptr<Table> table(new Table(seed + 0x9E3779B97F4A7C15ULL * (stats.tables + 1)));
+                    for (int i = 0; i < seats; i++)
+                        table->Join("Seat" + to_string(i + 1), threshold);
+
+                    // Reuse the first closed table number
+                    size_t id = 0;
+                    while (id < connection.tables.size() && connection.tables[id])
+                        id++;
+                    if (id == connection.tables.size())
+                        connection.tables.emplace_back();
+                    connection.tables[id] = std::move(table);
+                    stats.tables++;
+                    connection.output += "OK " + to_string(id) + "\n";
+                    return;
+                }
+                if (command == "QUIT")
+                {
+                    quit = true;
+                    return;
+                }
+
+                size_t id = 0;
+                if (!(request >> id) || id >= connection.tables.size() || !connection.tables[id])
+                    throw runtime_error("no such table");
+                Table &table = *connection.tables[id];
+
+                if (command == "JOIN")
+                {
+                    string name;
+                    int threshold = 0;
+                    if (!(request >> name >> threshold))
+                        throw runtime_error("usage JOIN table name threshold");
+                    table.Join(name, threshold);
+                    connection.output += "OK\n";
+                }
+                else if (command == "PLAY")
+                {
+                    uint64_t round = table.Play();
+                    stats.rounds++;
+                    connection.output += "RESULT " + to_string(round);
+                    for (Player &player : table.Players())
+                    {
+                        connection.output += " " + player.GetName() + " " + to_string(player.Score()) +
+                                             (player.isBusted ? " B" : (player.isWinner ? " W" : " -"));
+                    }
+                    connection.output += "\n";
+                }
+                else if (command == "CLOSE")
+                {
+                    connection.tables[id].reset();
+                    connection.output += "OK\n";
+                }
+                else
+                {
+                    throw runtime_error("unknown command");
+                }
+            }
+            catch (const std::exception &e)
+            {
+                connection.output += string("ERR ") + e.what() + "\n";
+            }
+        }
+
+        // Handle the complete request lines read so far, stopping at QUIT or while the unsent
+        // output is above the high-water mark. Return false if the connection must be closed.
+        bool serve(Connection &connection, uint64_t seed, ServerStats &stats)
+        {
+            size_t start = 0;
+            size_t end;
+            while (!connection.quitting && connection.output.size() - connection.sent <= OutputHighWater &&
+                   (end = connection.input.find('\n', start)) != string::npos)
+            {
+                handleLine(connection, connection.input.substr(start, end - start), seed, stats, connection.quitting);
+                start = end + 1;
+            }
+            connection.input.erase(0, start);
+            connection.paused = connection.output.size() - connection.sent > OutputHighWater;
+            return connection.quitting || connection.input.size() <= MaxLineLength ||
+                   connection.input.find('\n') != string::npos;
+        }
+
+        // Send as much output as the socket takes, return false if the connection failed
+        bool flush(Connection &connection)
+        {
+            while (connection.sent < connection.output.size())
+            {
+                ssize_t written = send(connection.fd, connection.output.data() + connection.sent,
+                                       connection.output.size() - connection.sent, MSG_NOSIGNAL);
+                if (written < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return true;
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+                connection.sent += written;
+            }
+            connection.output.clear();
+            connection.sent = 0;
+            return true;
+        }
+    }
+
+    /**
+     * @brief Creates and binds the non-blocking listening socket, and one eventfd per loop.
+     *
+     * @param config Server settings.
+     */
+    GameServer::GameServer(const ServerConfig &config) : _config(config), _port(0), _stopping(false)
+    {
+        if (_config.threads <= 0)
+            _config.threads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+
+        if (!_config.unixPath.empty())
+        {
+            sockaddr_un address;
+            memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            if (_config.unixPath.size() >= sizeof(address.sun_path))
+                throw runtime_error("Unix socket path is too long");
+            strcpy(address.sun_path, _config.unixPath.c_str());
+
+            _listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            unlink(_config.unixPath.c_str());
+            if (_listenFd < 0 || bind(_listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+            {
+                if (_listenFd >= 0)
+                    close(_listenFd);
+                throw runtime_error("Can not bind " + _config.unixPath);
+            }
+        }
+        else
+        {
+            sockaddr_in address;
+            memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(_config.port);
+
+            int on = 1;
+            _listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            if (_listenFd >= 0)
+                setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            if (_listenFd < 0 || bind(_listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+            {
+                if (_listenFd >= 0)
+                    close(_listenFd);
+                throw runtime_error("Can not bind port " + to_string(_config.port));
+            }
+
+            socklen_t length = sizeof(address);
+            getsockname(_listenFd, reinterpret_cast<sockaddr *>(&address), &length);
+            _port = ntohs(address.sin_port);
+        }
+
+        if (listen(_listenFd, 4096) != 0)
+        {
+            close(_listenFd);
+            throw runtime_error("Can not listen");
+        }
+
+        for (int i = 0; i < _config.threads; i++)
+        {
+            _wakeFds.push_back(eventfd(0, EFD_NONBLOCK));
+        }
+    }
+
+    /**
+     * @brief Closes the sockets.
+     */
+    GameServer::~GameServer()
+    {
+        for (int fd : _wakeFds)
+            close(fd);
+        close(_listenFd);
+        if (!_config.unixPath.empty())
+            unlink(_config.unixPath.c_str());
+    }
+
+    /**
+     * @brief Retrieves the bound TCP port.
+     *
+     * @return uint16_t The port, 0 for a Unix socket.
+     */
+    uint16_t GameServer::Port() const
+    {
+        return _port;
+    }
+
+    /**
+     * @brief Starts the loops and waits for all of them to finish.
+     */
+    void GameServer::Run()
+    {
+        _loopStats.assign(_config.threads, ServerStats());
+
+        vector<std::thread> threads;
+        for (int i = 1; i < _config.threads; i++)
+        {
+            threads.emplace_back(&GameServer::runLoop, this, i);
+        }
+        runLoop(0);
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        _stats = ServerStats();
+        for (const ServerStats &loop : _loopStats)
+        {
+            _stats.connections += loop.connections;
+            _stats.tables += loop.tables;
+            _stats.rounds += loop.rounds;
+            _stats.requests += loop.requests;
+        }
+    }
+
+    /**
+     * @brief Flags the stop and wakes every loop through its eventfd.
+     */
+    void GameServer::Stop()
+    {
+        _stopping.store(true);
+        uint64_t one = 1;
+        for (int fd : _wakeFds)
+        {
+            ssize_t ignored = write(fd, &one, sizeof(one));
+            (void)ignored;
+        }
+    }
+
+    /**
+     * @brief Retrieves the counters of the last Run.
+     *
+     * @return ServerStats Counters summed over the loops.
+     */
+    ServerStats GameServer::Stats() const
+    {
+        return _stats;
+    }
+
+    /**
+     * @brief The event loop: accepts connections, reads request lines, handles them and
+     *        writes the replies. Connections whose replies do not fit the socket wait for EPOLLOUT.
+     *        A client that sends requests without reading the replies is paused once
+     *        OutputHighWater bytes wait: it is not read, so TCP pushes back on it, until its
+     *        output has drained, which keeps the memory of every connection bounded.
+     *
+     * @param index Index of the loop.
+     */
+    void GameServer::runLoop(int index)
+    {
+        ServerStats &stats = _loopStats[index];
+        std::random_device device;
+        uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+
+        int epollFd = epoll_create1(0);
+        epoll_event event;
+        event.events = EPOLLIN | EPOLLEXCLUSIVE;
+        event.data.ptr = &_listenFd;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, _listenFd, &event);
+        event.events = EPOLLIN;
+        event.data.ptr = &_wakeFds[index];
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, _wakeFds[index], &event);
+
+        vector<epoll_event> events(256);
+        vector<char> chunk(ReadChunk);
+
+        std::unordered_set<Connection *> connections;
+        auto closeConnection = [&](Connection *connection)
+        {
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, connection->fd, nullptr);
+            close(connection->fd);
+            connections.erase(connection);
+            delete connection;
+        };
+
+        // Keep the registration in step with whether output is waiting and reading is paused
+        auto watch = [&](Connection *connection)
+        {
+            bool reading = !connection->paused && !connection->quitting;
+            uint32_t wanted = (reading ? EPOLLIN : 0) | (connection->output.empty() ? 0 : EPOLLOUT);
+            if (wanted == connection->events)
+                return;
+            epoll_event change;
+            change.events = wanted;
+            change.data.ptr = connection;
+            epoll_ctl(epollFd, EPOLL_CTL_MOD, connection->fd, &change);
+            connection->events = wanted;
+        };
+
+        while (!_stopping.load())
+        {
+            int ready = epoll_wait(epollFd, events.data(), events.size(), -1);
+            for (int e = 0; e < ready; e++)
+            {
+                if (events[e].data.ptr == &_wakeFds[index])
+                    continue;
+
+                if (events[e].data.ptr == &_listenFd)
+                {
+                    while (true)
+                    {
+                        int fd = accept4(_listenFd, nullptr, nullptr, SOCK_NONBLOCK);
+                        if (fd < 0)
+                            break;
+                        if (_config.unixPath.empty())
+                        {
+                            int on = 1;
+                            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+                        }
+                        Connection *connection = new Connection();
+                        connection->fd = fd;
+                        connection->sent = 0;
+                        connection->paused = false;
+                        connection->quitting = false;
+                        connection->events = EPOLLIN;
+                        epoll_event added;
+                        added.events = EPOLLIN;
+                        added.data.ptr = connection;
+                        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &added);
+                        connections.insert(connection);
+                        stats.connections++;
+                    }
+                    continue;
+                }
+
+                Connection *connection = static_cast<Connection *>(events[e].data.ptr);
+                bool closing = (events[e].events & (EPOLLERR | EPOLLHUP)) != 0 && (events[e].events & EPOLLIN) == 0;
+
+                if (!closing && !connection->paused && !connection->quitting && (events[e].events & EPOLLIN))
+                {
+                    ssize_t got = recv(connection->fd, chunk.data(), chunk.size(), 0);
+                    if (got <= 0)
+                        closing = got == 0 || (errno != EAGAIN && errno != EINTR);
+                    else
+                        connection->input.append(chunk.data(), got);
+                }
+
+                // Serve and send until the socket is full or no request is left; a paused
+                // connection resumes with the requests it already read once its output drained,
+                // and a quitting one closes then
+                while (!closing)
+                {
+                    if (!connection->paused && !connection->quitting)
+                        closing = !serve(*connection, seed, stats);
+                    if (!closing)
+                        closing = !flush(*connection);
+                    if (!closing && connection->output.empty())
+                    {
+                        connection->paused = false;
+                        closing = connection->quitting;
+                    }
+                    if (closing || !connection->output.empty() || connection->input.find('\n') == string::npos)
+                        break;
+                }
+                if (closing)
+                    closeConnection(connection);
+                else
+                    watch(connection);
+            }
+        }
+
+        while (!connections.empty())
+        {
+            closeConnection(*connections.begin());
+        }
+        close(epollFd);
+    }
+}
@@ -0,0 +1,264 @@
+/**
+ * @file HandHistory.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Implementation of HandHistoryWriter and HandHistoryReader, the binary hand history log.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <HandHistory.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        const uint32_t FormatVersion = 1;
+
+        HandHistoryHeader makeHeader()
+        {
+            HandHistoryHeader header;
+            memcpy(header.magic, "BJHH", 4);
+            header.version = FormatVersion;
+            header.recordSize = sizeof(HandRecord);
+            header.reserved = 0;
+            return header;
+        }
+
+        void checkHeader(const HandHistoryHeader &header, const string &path)
+        {
+            if (memcmp(header.magic, "BJHH", 4) != 0)
+                throw runtime_error(path + " is not a hand history log");
+            if (header.version != FormatVersion || header.recordSize != sizeof(HandRecord))
+                throw runtime_error(path + " has an unsupported hand history version");
+        }
+    }
+
+    /**
+     * @brief Opens the log for appending. A new or empty file gets a header, an existing log has its header checked.
+     *        A record torn by a crash during a write is cut off, so appended records stay aligned.
+     *
+     * @param path Path of the log.
+     * @param bufferRecords Records per block write.
+     */
+    HandHistoryWriter::HandHistoryWriter(const string &path, size_t bufferRecords)
+    {
+        _file = fopen(path.c_str(), "a+b");
+        if (_file == nullptr)
+            throw runtime_error("Can not open " + path);
+
+        try
+        {
+            fseek(_file, 0, SEEK_END);
+            long length = ftell(_file);
+            if (length < 0)
+                throw runtime_error("Can not read the length of " + path);
+
+            if (length == 0)
+            {
+                HandHistoryHeader header = makeHeader();
+                if (fwrite(&header, sizeof(header), 1, _file) != 1 || fflush(_file) != 0)
+                    throw runtime_error("Writing the hand history header of " + path + " failed");
+            }
+            else
+            {
+                HandHistoryHeader header;
+                fseek(_file, 0, SEEK_SET);
+                size_t read = fread(&header, sizeof(header), 1, _file);
+                if (read != 1)
+                    throw runtime_error(path + " is not a hand history log");
+                checkHeader(header, path);
+
+                size_t records = (static_cast<size_t>(length) - sizeof(header)) / sizeof(HandRecord);
+                size_t whole = sizeof(header) + records * sizeof(HandRecord);
+                if (whole != static_cast<size_t>(length) && ftruncate(fileno(_file), whole) != 0)
+                    throw runtime_error("Can not cut the torn last record of " + path);
+                fseek(_file, 0, SEEK_END);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            fclose(_file);
+            throw;
+        }
+
+        _buffer.resize(bufferRecords > 0 ? bufferRecords : 1);
+        _used = 0;
+        _records = 0;
+    }
+
+    /**
+     * @brief Flushes the buffered records and closes the log.
+     */
+    HandHistoryWriter::~HandHistoryWriter()
+    {
+        try
+        {
+            Flush();
+        }
+        catch (const std::exception &e)
+        {
+            // Nothing can be reported from a destructor, the records are lost
+        }
+        fclose(_file);
+    }
+
+    /**
+     * @brief Buffers one record, writing the block when it is full.
+     *
+     * @param record Record to append.
+     */
+    void HandHistoryWriter::Write(const HandRecord &record)
+    {
+        _buffer[_used++] = record;
+        _records++;
+        if (_used == _buffer.size())
+            Flush();
+    }
+
+    /**
+     * @brief Converts the results of a round into one record per seat.
+     *
+     * @param round Index of the round.
+     * @param shoe Shoe the round was played from.
+     * @param thresholds Threshold of each seat.
+     * @param results Result of each seat.
+     * @param seats Number of seats.
+     */
+    void HandHistoryWriter::WriteRound(uint64_t round, const uint8_t *shoe, const int *thresholds, const SeatResult *results, int seats)
+    {
+        for (int i = 0; i < seats; i++)
+        {
+            HandRecord record;
+            memset(&record, 0, sizeof(record));
+            record.round = round;
+            record.seat = static_cast<uint16_t>(i);
+            record.threshold = static_cast<uint8_t>(thresholds[i]);
+            record.score = static_cast<uint8_t>(results[i].score);
+            record.outcome = results[i].isBusted ? HandBusted : (results[i].isWinner ? HandWon : HandLost);
+            record.cardCount = static_cast<uint8_t>(results[i].cards);
+            int kept = results[i].cards < HandRecord::MaxCards ? results[i].cards : HandRecord::MaxCards;
+            memcpy(record.cards, shoe + results[i].first, kept);
+            Write(record);
+        }
+    }
+
+    /**
+     * @brief Writes the buffered records in one block.
+     */
+    void HandHistoryWriter::Flush()
+    {
+        if (_used == 0)
+            return;
+        size_t count = _used;
+        _used = 0;
+        if (fwrite(_buffer.data(), sizeof(HandRecord), count, _file) != count || fflush(_file) != 0)
+            throw runtime_error("Writing the hand history failed");
+    }
+
+    /**
+     * @brief Retrieves the number of records appended.
+     *
+     * @return uint64_t Records appended by this writer.
+     */
+    uint64_t HandHistoryWriter::Records() const
+    {
+        return _records;
+    }
+
+    /**
+     * @brief Maps the whole log read-only and checks its header.
+     *
+     * @param path Path of the log.
+     */
+    HandHistoryReader::HandHistoryReader(const string &path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw runtime_error("Can not open " + path);
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(HandHistoryHeader))
+        {
+            close(fd);
+            throw runtime_error(path + " is not a hand history log");
+        }
+
+        _size = info.st_size;
+        _map = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (_map == MAP_FAILED)
+            throw runtime_error("Can not map " + path);
+        madvise(_map, _size, MADV_SEQUENTIAL);
+
+        try
+        {
+            checkHeader(*static_cast<const HandHistoryHeader *>(_map), path);
+        }
+        catch (const std::exception &e)
+        {
+            munmap(_map, _size);
+            throw;
+        }
+
+        _records = reinterpret_cast<const HandRecord *>(static_cast<const char *>(_map) + sizeof(HandHistoryHeader));
+        // A record cut short by a crashed writer is left out
+        _count = (_size - sizeof(HandHistoryHeader)) / sizeof(HandRecord);
+    }
+
+    /**
+     * @brief Unmaps the log.
+     */
+    HandHistoryReader::~HandHistoryReader()
+    {
+        munmap(_map, _size);
+    }
+
+    /**
+     * @brief Retrieves the number of records.
+     *
+     * @return size_t Complete records in the log.
+     */
+    size_t HandHistoryReader::Count() const
+    {
+        return _count;
+    }
+
+    /**
+     * @brief Retrieves a record straight from the mapping.
+     *
+     * @param index Record index.
+     * @return const HandRecord& The record.
+     */
+    const HandRecord &HandHistoryReader::operator[](size_t index) const
+    {
+        return _records[index];
+    }
+
+    /**
+     * @brief Retrieves the first record.
+     *
+     * @return const HandRecord* First record.
+     */
+    const HandRecord *HandHistoryReader::begin() const
+    {
+        return _records;
+    }
+
+    /**
+     * @brief Retrieves the end of the records.
+     *
+     * @return const HandRecord* One past the last record.
+     */
+    const HandRecord *HandHistoryReader::end() const
+    {
+        return _records + _count;
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file InfiniteDeck.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief InfiniteDeck class implementation, a card source that draws with replacement.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <limits>
+#include <CardCode.h>
+#include <InfiniteDeck.h>
+
+namespace chants
+{
+
+    /**
+     * @brief Construct a new InfiniteDeck for one round of a seeded run.
+     *
+     * @param seed Seed of the run.
+     * @param round Index of the round.
+     */
+    InfiniteDeck::InfiniteDeck(uint64_t seed, uint64_t round) : _stream(seed, round)
+    {
+    }
+
+    /**
+     * @brief Draws one of the 52 cards with equal probability.
+     *
+     * @return Card The drawn card, face down.
+     */
+    Card InfiniteDeck::Deal()
+    {
+        uint8_t code = static_cast<uint8_t>(_stream.Bounded(CardsPerDeck));
+        return Card(CodeToValue(code), CodeToSuit(code), false);
+    }
+
+    /**
+     * @brief Describes the deck, there are no cards to list.
+     *
+     * @return string Description of the deck.
+     */
+    string InfiniteDeck::ToString()
+    {
+        return "Infinite deck\n";
+    }
+
+    /**
+     * @brief Retrieves the number of cards left, which is unlimited.
+     *
+     * @return int Largest int.
+     */
+    int InfiniteDeck::CardsInDeck()
+    {
+        return numeric_limits<int>::max();
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file MonotonicArena.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief MonotonicArena implementation, a bump allocator over a list of heap blocks.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <cstdint>
+#include <new>
+#include <MonotonicArena.h>
+
+namespace chants
+{
+
+    /**
+     * @brief Construct an empty arena.
+     *
+     * @param blockBytes Size of each heap block.
+     */
+    MonotonicArena::MonotonicArena(size_t blockBytes)
+        : _head(nullptr), _cursor(nullptr), _end(nullptr), _blockBytes(blockBytes), _reserved(0), _used(0)
+    {
+    }
+
+    /**
+     * @brief Frees every block.
+     */
+    MonotonicArena::~MonotonicArena()
+    {
+        Release();
+    }
+
+    /**
+     * @brief Takes a block of the normal size, or a bigger one for a large allocation, and
+     *        makes it current. What was left of the previous block is abandoned.
+     *
+     * @param bytes Size of the allocation.
+     * @param alignment Alignment of the allocation.
+     */
+    void MonotonicArena::grow(size_t bytes, size_t alignment)
+    {
+        size_t needed = sizeof(Block) + bytes + alignment;
+        size_t size = needed > _blockBytes ? needed : _blockBytes;
+        Block *block = static_cast<Block *>(::operator new(size));
+        block->next = _head;
+        block->size = size;
+        _head = block;
+        _cursor = reinterpret_cast<char *>(block + 1);
+        _end = reinterpret_cast<char *>(block) + size;
+        _reserved += size;
+    }
+
+    /**
+     * @brief Rounds the cursor up to the alignment and moves it past the allocation.
+     *
+     * @param bytes Size of the allocation.
+     * @param alignment Power of two.
+     * @return void* The memory.
+     */
+    void *MonotonicArena::Allocate(size_t bytes, size_t alignment)
+    {
+        uintptr_t cursor = reinterpret_cast<uintptr_t>(_cursor);
+        uintptr_t aligned = (cursor + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        if (_cursor == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(_end))
+        {
+            grow(bytes, alignment);
+            cursor = reinterpret_cast<uintptr_t>(_cursor);
+            aligned = (cursor + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        }
+        _cursor = reinterpret_cast<char *>(aligned + bytes);
+        _used += bytes;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    /**
+     * @brief Frees the blocks one by one and starts over empty.
+     */
+    void MonotonicArena::Release()
+    {
+        while (_head != nullptr)
+        {
+            Block *next = _head->next;
+            ::operator delete(_head);
+            _head = next;
+        }
+        _cursor = nullptr;
+        _end = nullptr;
+        _reserved = 0;
+        _used = 0;
+    }
+
+    /**
+     * @brief Retrieves the bytes handed out.
+     *
+     * @return size_t Bytes.
+     */
+    size_t MonotonicArena::BytesUsed() const
+    {
+        return _used;
+    }
+
+    /**
+     * @brief Retrieves the bytes taken from the heap.
+     *
+     * @return size_t Bytes.
+     */
+    size_t MonotonicArena::BytesReserved() const
+    {
+        return _reserved;
+    }
+}
@@ -0,0 +1,212 @@
+/**
+ * @file MultiCounter.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief MultiCounter implementation, many card counting systems updated from one card stream.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <CardCode.h>
+#include <MultiCounter.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Columns are padded to a multiple of this, eight 32 bit lanes fill an AVX2 register
+        const size_t Lanes = 8;
+        /// @brief The true count divides by at least this many decks, so it stays finite at the cut
+        const double MinDecksLeft = 0.25;
+    }
+
+    /**
+     * @brief Builds the list of well known systems. Wong Halves is stored doubled.
+     *
+     * @return vector<CountingSystem> The systems.
+     */
+    vector<CountingSystem> StandardCountingSystems()
+    {
+        //                    2   3   4   5   6   7   8   9   T   A
+        return {
+            {"Hi-Lo",       {+1, +1, +1, +1, +1, +0, +0, +0, -1, -1}, 1},
+            {"Hi-Opt I",    {+0, +1, +1, +1, +1, +0, +0, +0, -1, +0}, 1},
+            {"Hi-Opt II",   {+1, +1, +2, +2, +1, +1, +0, +0, -2, +0}, 1},
+            {"KO",          {+1, +1, +1, +1, +1, +1, +0, +0, -1, -1}, 1},
+            {"Omega II",    {+1, +1, +2, +2, +2, +1, +0, -1, -2, +0}, 1},
+            {"Zen",         {+1, +1, +2, +2, +2, +1, +0, +0, -2, -1}, 1},
+            {"Wong Halves", {+1, +2, +2, +3, +2, +1, +0, -1, -2, -2}, 2},
+            {"Uston APC",   {+1, +2, +2, +3, +2, +2, +1, -1, -3, +0}, 1},
+            {"Ace-Five",    {+0, +0, +0, +1, +0, +0, +0, +0, +0, -1}, 1}};
+    }
+
+    /**
+     * @brief Construct a new MultiCounter, laying the tags out rank by rank so one card reads
+     *        one contiguous row.
+     *
+     * @param systems Systems to count.
+     * @param decks Decks in a full shoe.
+     * @param ramp Bet sizing.
+     */
+    MultiCounter::MultiCounter(const vector<CountingSystem> &systems, int decks, BetRamp ramp)
+        : _systems(systems), _shoeCards(decks * CardsPerDeck), _seen(0), _ramp(ramp)
+    {
+        if (systems.empty())
+            throw runtime_error("No counting systems");
+        if (decks < 1)
+            throw runtime_error("A shoe needs at least one deck");
+
+        _stride = (systems.size() + Lanes - 1) / Lanes * Lanes;
+        _tags.assign(10 * _stride, 0);
+        _running.assign(_stride, 0);
+        for (size_t s = 0; s < systems.size(); s++)
+        {
+            for (int rank = 0; rank < 10; rank++)
+                _tags[rank * _stride + s] = systems[s].tags[rank];
+        }
+
+        _bets.assign(systems.size(), ramp.minUnits);
+        _wagered.assign(systems.size(), 0);
+        _results.assign(systems.size(), RunningStats());
+    }
+
+    /**
+     * @brief Adds the card's row of tags to the running counts. Padding columns hold zero tags.
+     *
+     * @param points Card points 2 - 11.
+     */
+    void MultiCounter::AddPoints(int points)
+    {
+        const int32_t *row = &_tags[(points - 2) * _stride];
+        int32_t *running = _running.data();
+        for (size_t s = 0; s < _stride; s++)
+            running[s] += row[s];
+        _seen++;
+    }
+
+    /**
+     * @brief Counts a dealt card.
+     *
+     * @param card The card.
+     */
+    void MultiCounter::AddCard(Card &card)
+    {
+        AddPoints(card.GetValue());
+    }
+
+    /**
+     * @brief Resets the counts for a fresh shoe.
+     */
+    void MultiCounter::Shuffle()
+    {
+        fill(_running.begin(), _running.end(), 0);
+        _seen = 0;
+    }
+
+    /**
+     * @brief Bets the floor of each system's true count, kept within the ramp.
+     */
+    void MultiCounter::PlaceBets()
+    {
+        for (size_t s = 0; s < _systems.size(); s++)
+        {
+            int units = static_cast<int>(floor(TrueCount(s)));
+            _bets[s] = min(max(units, _ramp.minUnits), _ramp.maxUnits);
+        }
+    }
+
+    /**
+     * @brief Adds each system's bet times the result to its totals.
+     *
+     * @param result Win per unit bet.
+     */
+    void MultiCounter::SettleRound(double result)
+    {
+        for (size_t s = 0; s < _systems.size(); s++)
+        {
+            _wagered[s] += _bets[s];
+            _results[s].Add(_bets[s] * result);
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of systems.
+     *
+     * @return size_t Number of systems.
+     */
+    size_t MultiCounter::Systems() const
+    {
+        return _systems.size();
+    }
+
+    /**
+     * @brief Retrieves a system.
+     *
+     * @param system Column of the system.
+     * @return const CountingSystem& The system.
+     */
+    const CountingSystem &MultiCounter::System(size_t system) const
+    {
+        return _systems.at(system);
+    }
+
+    /**
+     * @brief Retrieves a running count in whole points.
+     *
+     * @param system Column of the system.
+     * @return double The running count.
+     */
+    double MultiCounter::RunningCount(size_t system) const
+    {
+        return static_cast<double>(_running.at(system)) / _systems[system].unit;
+    }
+
+    /**
+     * @brief Divides the running count by the decks not yet dealt.
+     *
+     * @param system Column of the system.
+     * @return double The true count.
+     */
+    double MultiCounter::TrueCount(size_t system) const
+    {
+        double decksLeft = max(static_cast<double>(_shoeCards - _seen) / CardsPerDeck, MinDecksLeft);
+        return RunningCount(system) / decksLeft;
+    }
+
+    /**
+     * @brief Retrieves a system's current bet.
+     *
+     * @param system Column of the system.
+     * @return int Units.
+     */
+    int MultiCounter::Bet(size_t system) const
+    {
+        return _bets.at(system);
+    }
+
+    /**
+     * @brief Retrieves the units a system has wagered.
+     *
+     * @param system Column of the system.
+     * @return uint64_t Units.
+     */
+    uint64_t MultiCounter::Wagered(size_t system) const
+    {
+        return _wagered.at(system);
+    }
+
+    /**
+     * @brief Retrieves a system's results.
+     *
+     * @param system Column of the system.
+     * @return const RunningStats& Win per round in units.
+     */
+    const RunningStats &MultiCounter::Results(size_t system) const
+    {
+        return _results.at(system);
+    }
+}
@@ -0,0 +1,270 @@
+/**
+ * @file Pipeline.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Pipeline class implementation, which runs shuffling, playing and aggregation as separate thread stages.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <BoundedQueue.h>
+#include <Pipeline.h>
+#include <Round.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Slot number pushed once per consumer to tell it the producers are done
+        const int EndOfWork = -1;
+
+        uint64_t nowNanos()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        // Push, yielding while the queue is full, and charge the wait to blocked
+        void pushWaiting(BoundedQueue<int> &queue, int item, uint64_t &blocked)
+        {
+            if (queue.TryPush(item))
+                return;
+            uint64_t start = nowNanos();
+            while (!queue.TryPush(item))
+                std::this_thread::yield();
+            blocked += nowNanos() - start;
+        }
+
+        // Pop, yielding while the queue is empty, and charge the wait to starved
+        int popWaiting(BoundedQueue<int> &queue, uint64_t &starved)
+        {
+            int item;
+            if (queue.TryPop(item))
+                return item;
+            uint64_t start = nowNanos();
+            while (!queue.TryPop(item))
+                std::this_thread::yield();
+            starved += nowNanos() - start;
+            return item;
+        }
+
+        void addStats(StageStats &total, const StageStats &part)
+        {
+            total.items += part.items;
+            total.busyNanos += part.busyNanos;
+            total.starvedNanos += part.starvedNanos;
+            total.blockedNanos += part.blockedNanos;
+        }
+    }
+
+    /**
+     * @brief Returns items per busy second of one thread. busyNanos is already summed over the
+     *        threads, so items over it is the rate of one thread.
+     *
+     * @return double Zero when the stage did no work.
+     */
+    double StageStats::ThroughputPerThread() const
+    {
+        if (busyNanos == 0)
+            return 0;
+        return items * 1e9 / busyNanos;
+    }
+
+    /**
+     * @brief Construct a new Pipeline object after checking the settings.
+     *
+     * @param config Settings of the run.
+     */
+    Pipeline::Pipeline(const PipelineConfig &config) : _config(config)
+    {
+        if (config.shufflerThreads < 1 || config.playerThreads < 1)
+            throw runtime_error("Every stage needs at least one thread");
+        if (config.queueCapacity < 1 || config.shoesPerSlot < 1)
+            throw runtime_error("Queue capacity and shoes per slot must be at least 1");
+        if (config.decksPerShoe < 1)
+            throw runtime_error("A shoe needs at least one deck");
+        if (config.thresholds.empty())
+            throw runtime_error("A round needs at least one seat");
+        for (int threshold : config.thresholds)
+        {
+            if (threshold < 1 || threshold > 21)
+                throw runtime_error("Threshold must be between 1 and 21");
+        }
+    }
+
+    /**
+     * @brief Runs the three stages until every round is played and folded.
+     *        A slot travels free -> ready -> done -> free, so the number of slots caps the
+     *        work in flight and a slow stage stalls the stage in front of it.
+     *
+     * @return PipelineReport Results and per stage statistics.
+     */
+    PipelineReport Pipeline::Run()
+    {
+        const int seats = static_cast<int>(_config.thresholds.size());
+        const int shoeSize = CardsPerDeck * _config.decksPerShoe;
+        const int slots = _config.queueCapacity;
+        const int slotSize = shoeSize * _config.shoesPerSlot;
+        const int queueSize = slots + _config.shufflerThreads + _config.playerThreads;
+
+        // Everything the stages touch is allocated here, before any thread starts
+        vector<uint8_t> shoes(static_cast<size_t>(slots) * slotSize);
+        vector<int> shoesInSlot(slots, 0);
+        vector<uint64_t> slotFirstRound(slots, 0);
+        vector<char> slotWaiting(slots, 0);
+        vector<SimulationStats> slotStats(slots, SimulationStats(seats));
+        vector<uint64_t> slotOverDealt(slots, 0);
+        BoundedQueue<int> freeSlots(queueSize);
+        BoundedQueue<int> readySlots(queueSize);
+        BoundedQueue<int> doneSlots(queueSize);
+        for (int slot = 0; slot < slots; slot++)
+        {
+            freeSlots.TryPush(slot);
+        }
+
+        std::atomic<uint64_t> nextRound(0);
+        std::atomic<bool> stop(false);
+        std::atomic<int> shufflersRunning(_config.shufflerThreads);
+        vector<StageStats> shuffleStats(_config.shufflerThreads);
+        vector<StageStats> playStats(_config.playerThreads);
+        StageStats aggregateStats;
+        PipelineReport report(seats);
+
+        uint64_t started = nowNanos();
+        vector<std::thread> threads;
+
+        for (int t = 0; t < _config.shufflerThreads; t++)
+        {
+            threads.emplace_back([&, t]()
+                                 {
+                StageStats &stats = shuffleStats[t];
+                // Rounds are claimed from a shared counter and keyed by their index, so the
+                // shoes are the same whatever the number of shufflers. A slot is taken before
+                // the rounds, so every batch before one the aggregator holds back already has
+                // a slot and is on its way
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    int slot = popWaiting(freeSlots, stats.starvedNanos);
+                    uint64_t first = nextRound.fetch_add(_config.shoesPerSlot);
+                    if (first >= _config.rounds)
+                    {
+                        freeSlots.TryPush(slot);
+                        break;
+                    }
+                    uint64_t left = _config.rounds - first;
+                    int count = left < static_cast<uint64_t>(_config.shoesPerSlot) ? static_cast<int>(left) : _config.shoesPerSlot;
+
+                    uint64_t start = nowNanos();
+                    ShuffleKernel::ShuffleRounds(_config.seed, first, &shoes[static_cast<size_t>(slot) * slotSize],
+                                                 count, _config.decksPerShoe);
+                    shoesInSlot[slot] = count;
+                    slotFirstRound[slot] = first;
+                    stats.busyNanos += nowNanos() - start;
+                    stats.items++;
+                    pushWaiting(readySlots, slot, stats.blockedNanos);
+                }
+
+                // The last shuffler out tells every player there is nothing more coming
+                if (shufflersRunning.fetch_sub(1) == 1)
+                {
+                    for (int p = 0; p < _config.playerThreads; p++)
+                        pushWaiting(readySlots, EndOfWork, stats.blockedNanos);
+                } });
+        }
+
+        for (int t = 0; t < _config.playerThreads; t++)
+        {
+            threads.emplace_back([&, t]()
+                                 {
+                StageStats &stats = playStats[t];
+                vector<SeatResult> results(seats);
+                while (true)
+                {
+                    int slot = popWaiting(readySlots, stats.starvedNanos);
+                    if (slot == EndOfWork)
+                        break;
+
+                    uint64_t start = nowNanos();
+                    SimulationStats &batch = slotStats[slot];
+                    batch.Clear();
+                    slotOverDealt[slot] = 0;
+                    for (int k = 0; k < shoesInSlot[slot]; k++)
+                    {
+                        const uint8_t *shoe = &shoes[static_cast<size_t>(slot) * slotSize + static_cast<size_t>(k) * shoeSize];
+                        if (PlayRound(shoe, shoeSize, _config.thresholds.data(), seats, results.data()) < 0)
+                        {
+                            slotOverDealt[slot]++;
+                            continue;
+                        }
+                        batch.AddRound(results.data(), _config.thresholds.data());
+                    }
+                    stats.busyNanos += nowNanos() - start;
+                    stats.items++;
+                    pushWaiting(doneSlots, slot, stats.blockedNanos);
+                }
+                pushWaiting(doneSlots, EndOfWork, stats.blockedNanos); });
+        }
+
+        threads.emplace_back([&]()
+                             {
+            // Batches are merged in round order, holding back any that finish early, because
+            // streaks joined across a merge depend on the order
+            int playersRunning = _config.playerThreads;
+            uint64_t nextFirst = 0;
+            while (playersRunning > 0)
+            {
+                int done = popWaiting(doneSlots, aggregateStats.starvedNanos);
+                if (done == EndOfWork)
+                {
+                    playersRunning--;
+                    continue;
+                }
+                slotWaiting[done] = 1;
+
+                uint64_t start = nowNanos();
+                for (int slot = 0; slot < slots;)
+                {
+                    if (!slotWaiting[slot] || slotFirstRound[slot] != nextFirst)
+                    {
+                        slot++;
+                        continue;
+                    }
+                    slotWaiting[slot] = 0;
+                    nextFirst += shoesInSlot[slot];
+                    report.overDealt += slotOverDealt[slot];
+                    report.stats.Merge(slotStats[slot]);
+                    if (!report.stoppedEarly && report.stats.ReachedPrecision(_config.earlyStop))
+                    {
+                        report.stoppedEarly = true;
+                        stop.store(true, std::memory_order_relaxed);
+                    }
+                    aggregateStats.items++;
+                    pushWaiting(freeSlots, slot, aggregateStats.blockedNanos);
+                    slot = 0;
+                }
+                aggregateStats.busyNanos += nowNanos() - start;
+            } });
+
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        report.seconds = (nowNanos() - started) / 1e9;
+        report.shuffle.threads = _config.shufflerThreads;
+        report.play.threads = _config.playerThreads;
+        report.aggregate.threads = 1;
+        for (const StageStats &stats : shuffleStats)
+            addStats(report.shuffle, stats);
+        for (const StageStats &stats : playStats)
+            addStats(report.play, stats);
+        addStats(report.aggregate, aggregateStats);
+        return report;
+    }
+}
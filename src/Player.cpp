@@ -8,6 +8,8 @@
  *
  */
 #include <stdexcept>
+#include <utility>
+#include <CardCode.h>
 #include <Player.h>
 
 namespace chants
@@ -21,7 +23,8 @@ namespace chants
      */
     Player::Player(string name, int threshold)
     {
-        _name = name;
+        _name = move(name);
+        _hand.reserve(ReservedCards);
 
         if (threshold < 1 || threshold > 21)
             throw runtime_error("Threshold must be between 1 and 21");
@@ -100,11 +103,14 @@ namespace chants
     }
 
     /**
-     * @brief Clears all cards from the player's hand.
+     * @brief Clears all cards from the player's hand and the results of the last round,
+     *        keeping the hand's storage.
      */
     void Player::EmptyHand()
     {
         _hand.clear();
+        isBusted = false;
+        isWinner = false;
     }
 
     /**
@@ -120,15 +126,16 @@ namespace chants
     /**
      * @brief Retrieves the player's name.
      *
-     * @return string Player's name.
+     * @return const string& Player's name.
      */
-    string Player::GetName()
+    const string &Player::GetName() const
     {
         return _name;
     }
 
     /**
-     * @brief Calculates the player's score, adjusting for Aces as needed to keep the score below or equal to 21.
+     * @brief Calculates the player's score with HandScore: Aces count 11 unless that goes over 21,
+     *        and then every Ace counts 1.
      *
      * @return int Player's calculated score.
      */
@@ -147,20 +154,6 @@ namespace chants
             score += val;
         }
 
-        if (score > 21)
-        {
-            while (true)
-            {
-                if (numberOfAces > 0)
-                {
-                    score = score - 10;
-                    numberOfAces--;
-                }
-                else
-                    break;
-            }
-        }
-
-        return score;
+        return HandScore(score, numberOfAces);
     }
 }
\ No newline at end of file
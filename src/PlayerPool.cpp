@@ -0,0 +1,231 @@
+/**
+ * @file PlayerPool.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief PlayerPool and PooledPlayer implementation, players made from one arena.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <CardCode.h>
+#include <PlayerPool.h>
+
+namespace chants
+{
+
+    static_assert(is_trivially_destructible<PooledPlayer>::value, "Release frees players without destroying them");
+
+    const int PooledPlayer::HandCards;
+
+    /**
+     * @brief Construct a new PooledPlayer with room for a full one deck hand.
+     *
+     * @param name Interned name.
+     * @param threshold Threshold 1 - 21.
+     * @param arena Memory for the hand.
+     */
+    PooledPlayer::PooledPlayer(NameView name, int threshold, MonotonicArena *arena)
+        : _name(name), _winThreshold(threshold), _cards(0), _capacity(HandCards),
+          _total(0), _aces(0), _arena(arena), isBusted(false), isWinner(false)
+    {
+        if (threshold < 1 || threshold > 21)
+            throw runtime_error("Threshold must be between 1 and 21");
+        _hand = arena->AllocateArray<Card>(_capacity);
+    }
+
+    /**
+     * @brief Retrieves the name.
+     *
+     * @return NameView The interned name.
+     */
+    NameView PooledPlayer::GetName() const
+    {
+        return _name;
+    }
+
+    /**
+     * @brief Retrieves the threshold.
+     *
+     * @return int The threshold.
+     */
+    int PooledPlayer::GetThreshold() const
+    {
+        return _winThreshold;
+    }
+
+    /**
+     * @brief Adds a card and updates the totals, moving the hand to a room twice the size in
+     *        the arena when it is full. Only a hand of more than HandCards cards grows, which
+     *        no one deck deal reaches.
+     *
+     * @param card The card.
+     */
+    void PooledPlayer::AddCard(Card card)
+    {
+        if (_cards == _capacity)
+        {
+            Card *bigger = _arena->AllocateArray<Card>(_capacity * 2);
+            memcpy(static_cast<void *>(bigger), _hand, sizeof(Card) * _cards);
+            _hand = bigger;
+            _capacity *= 2;
+        }
+        _hand[_cards++] = card;
+
+        int points = card.GetValue();
+        if (points == 11)
+            _aces++;
+        _total += points;
+    }
+
+    /**
+     * @brief Retrieves the score the way Player::Score counts it: Aces are 11 unless that
+     *        puts the hand over 21, and then every Ace is 1.
+     *
+     * @return int The score.
+     */
+    int PooledPlayer::Score() const
+    {
+        return HandScore(_total, _aces);
+    }
+
+    /**
+     * @brief Retrieves the number of cards in the hand.
+     *
+     * @return int Number of cards.
+     */
+    int PooledPlayer::CountCards() const
+    {
+        return _cards;
+    }
+
+    /**
+     * @brief Empties the hand for a new round.
+     */
+    void PooledPlayer::EmptyHand()
+    {
+        _cards = 0;
+        _total = 0;
+        _aces = 0;
+        isBusted = false;
+        isWinner = false;
+    }
+
+    /**
+     * @brief Turns every card in the hand.
+     *
+     * @param faceUp True for face up.
+     */
+    void PooledPlayer::FlipAllCards(bool faceUp)
+    {
+        for (int i = 0; i < _cards; i++)
+        {
+            _hand[i].isFaceUp = faceUp;
+        }
+    }
+
+    /**
+     * @brief Lists the cards of the hand.
+     *
+     * @return string The hand as text.
+     */
+    string PooledPlayer::ShowHand() const
+    {
+        string temp = "";
+        for (int i = 0; i < _cards; i++)
+        {
+            temp += _hand[i].ToString() + " ";
+        }
+        return temp;
+    }
+
+    /**
+     * @brief Construct an empty PlayerPool.
+     *
+     * @param blockBytes Size of each arena block.
+     */
+    PlayerPool::PlayerPool(size_t blockBytes) : _arena(blockBytes), _names(_arena)
+    {
+    }
+
+    /**
+     * @brief Makes a player in the arena with an interned name.
+     *
+     * @param name Name of the player.
+     * @param threshold Threshold 1 - 21.
+     * @return PooledPlayer& The player.
+     */
+    PooledPlayer &PlayerPool::Add(NameView name, int threshold)
+    {
+        if (threshold < 1 || threshold > 21)
+            throw runtime_error("Threshold must be between 1 and 21");
+        void *memory = _arena.Allocate(sizeof(PooledPlayer), alignof(PooledPlayer));
+        PooledPlayer *player = new (memory) PooledPlayer(_names.Intern(name), threshold, &_arena);
+        _players.push_back(player);
+        return *player;
+    }
+
+    /**
+     * @brief Reserves the index of players.
+     *
+     * @param players Total players expected.
+     */
+    void PlayerPool::Reserve(size_t players)
+    {
+        _players.reserve(players);
+    }
+
+    /**
+     * @brief Retrieves the number of players.
+     *
+     * @return size_t Number of players.
+     */
+    size_t PlayerPool::Size() const
+    {
+        return _players.size();
+    }
+
+    /**
+     * @brief Retrieves a player.
+     *
+     * @param index Index in the order made.
+     * @return PooledPlayer& The player.
+     */
+    PooledPlayer &PlayerPool::operator[](size_t index)
+    {
+        return *_players[index];
+    }
+
+    /**
+     * @brief Retrieves the number of distinct names.
+     *
+     * @return size_t Number of names.
+     */
+    size_t PlayerPool::Names() const
+    {
+        return _names.Count();
+    }
+
+    /**
+     * @brief Retrieves the bytes of the arena.
+     *
+     * @return size_t Bytes.
+     */
+    size_t PlayerPool::BytesReserved() const
+    {
+        return _arena.BytesReserved();
+    }
+
+    /**
+     * @brief Forgets every player and name, then frees the arena. PooledPlayer and Card are
+     *        trivially destructible, so no destructors need to run.
+     */
+    void PlayerPool::Release()
+    {
+        vector<PooledPlayer *>().swap(_players);
+        _names.Clear();
+        _arena.Release();
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * @file Round.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Implementation of PlayRound, which plays one threshold round straight from a shoe of card codes.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <Round.h>
+#include <Seat.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Code of a King, what a ShoeCursor deals once the shoe is used up
+        const uint8_t OverDealtCode = 12;
+
+        // One seat of PlayRound with the playing interface of Player that PlaySeat uses,
+        // keeping the running totals of the codes added instead of the cards
+        struct ShoeSeat
+        {
+            int points;
+            int aces;
+            int score;
+            int threshold;
+            bool isBusted;
+
+            void EmptyHand()
+            {
+                points = 0;
+                aces = 0;
+                score = 0;
+                isBusted = false;
+            }
+
+            void AddCard(uint8_t code)
+            {
+                score = AddToScore(points, aces, code);
+            }
+
+            int Score() const
+            {
+                return score;
+            }
+
+            int GetThreshold() const
+            {
+                return threshold;
+            }
+
+            void FlipAllCards(bool)
+            {
+            }
+        };
+
+        // The shoe as PlaySeat's deck. Past the usable cards it flags the round and deals tens,
+        // which end the seat at once, instead of throwing as Deck::Deal does
+        struct ShoeCursor
+        {
+            const uint8_t *shoe;
+            int next;
+            int usable;
+            bool overDealt;
+
+            uint8_t Deal()
+            {
+                if (next >= usable)
+                {
+                    overDealt = true;
+                    return OverDealtCode;
+                }
+                return shoe[next++];
+            }
+        };
+    }
+
+    /**
+     * @brief Plays every seat in order from the top of the shoe with PlaySeat, then marks the winners.
+     *
+     * @param shoe Card codes, first code is dealt first.
+     * @param shoeSize Number of codes in the shoe.
+     * @param thresholds Threshold of each seat.
+     * @param seats Number of seats.
+     * @param results One result per seat.
+     * @return int Cards dealt, or -1 if the shoe ran out.
+     */
+    int PlayRound(const uint8_t *shoe, int shoeSize, const int *thresholds, int seats, SeatResult *results)
+    {
+        // Deck::Deal refuses to deal the last card, keep the same behavior
+        ShoeCursor cursor = {shoe, 0, shoeSize - 1, false};
+        ShoeSeat seat;
+
+        for (int i = 0; i < seats; i++)
+        {
+            seat.threshold = thresholds[i];
+            results[i].first = cursor.next;
+            PlaySeat(seat, cursor);
+            if (cursor.overDealt)
+                return -1;
+
+            results[i].cards = cursor.next - results[i].first;
+            results[i].score = seat.score;
+            results[i].isBusted = seat.isBusted;
+            results[i].isWinner = false;
+        }
+
+        MarkWinners(results, seats);
+        return cursor.next;
+    }
+
+    /**
+     * @brief Marks every seat that is not busted and has the highest score as a winner.
+     *
+     * @param results One result per seat.
+     * @param seats Number of seats.
+     */
+    void MarkWinners(SeatResult *results, int seats)
+    {
+        int highestScore = -1;
+        for (int i = 0; i < seats; i++)
+        {
+            results[i].isWinner = false;
+            if (results[i].score <= 21 && results[i].score > highestScore)
+                highestScore = results[i].score;
+        }
+
+        for (int i = 0; i < seats; i++)
+        {
+            if (results[i].score == highestScore)
+                results[i].isWinner = true;
+        }
+    }
+}
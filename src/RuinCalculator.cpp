@@ -0,0 +1,385 @@
+/**
+ * @file RuinCalculator.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief RuinCalculator implementation, bankroll distributions by blocked FFT convolution.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <map>
+#include <stdexcept>
+#include <RuinCalculator.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Entries at either end of a distribution below this are dropped
+        const double TrimBelow = 1e-16;
+
+        // Smallest power of two at or above n
+        size_t powerOfTwo(size_t n)
+        {
+            size_t size = 1;
+            while (size < n)
+                size <<= 1;
+            return size;
+        }
+
+        // In place iterative radix-2 FFT, inverse when invert is true, unscaled
+        void fft(vector<complex<double>> &data, bool invert)
+        {
+            const size_t n = data.size();
+            for (size_t i = 1, j = 0; i < n; i++)
+            {
+                size_t bit = n >> 1;
+                for (; j & bit; bit >>= 1)
+                    j ^= bit;
+                j ^= bit;
+                if (i < j)
+                    swap(data[i], data[j]);
+            }
+
+            // Twiddles computed directly rather than by repeated multiplication, which drifts
+            vector<complex<double>> roots(n / 2);
+            for (size_t k = 0; k < n / 2; k++)
+            {
+                double angle = 2 * M_PI * k / n * (invert ? 1 : -1);
+                roots[k] = complex<double>(cos(angle), sin(angle));
+            }
+            for (size_t length = 2; length <= n; length <<= 1)
+            {
+                const size_t stride = n / length;
+                for (size_t start = 0; start < n; start += length)
+                {
+                    for (size_t k = 0; k < length / 2; k++)
+                    {
+                        complex<double> even = data[start + k];
+                        complex<double> odd = data[start + k + length / 2] * roots[k * stride];
+                        data[start + k] = even + odd;
+                        data[start + k + length / 2] = even - odd;
+                    }
+                }
+            }
+        }
+
+        // Back from the frequency domain to count real probabilities, rounding noise cleared
+        vector<double> inverseToProbabilities(vector<complex<double>> &spectrum, size_t count)
+        {
+            fft(spectrum, true);
+            vector<double> result(count);
+            const double scale = 1.0 / spectrum.size();
+            for (size_t i = 0; i < count; i++)
+                result[i] = max(0.0, spectrum[i].real() * scale);
+            return result;
+        }
+
+        // The spectrum, at an FFT size of at least times * (kernel.size() - 1) + 1, of the
+        // distribution of the sum of times draws from kernel, by raising the kernel's spectrum
+        vector<complex<double>> kernelPowerSpectrum(const vector<double> &kernel, uint64_t times, size_t size)
+        {
+            vector<complex<double>> spectrum(size);
+            copy(kernel.begin(), kernel.end(), spectrum.begin());
+            fft(spectrum, false);
+            for (complex<double> &value : spectrum)
+            {
+                complex<double> power(1);
+                complex<double> base = value;
+                for (uint64_t bits = times; bits > 0; bits >>= 1)
+                {
+                    if (bits & 1)
+                        power *= base;
+                    base *= base;
+                }
+                value = power;
+            }
+            return spectrum;
+        }
+
+        // Drop negligible entries from both ends, moving base past the ones dropped in front
+        void trim(vector<double> &dist, int64_t &base)
+        {
+            size_t front = 0;
+            while (front < dist.size() && dist[front] < TrimBelow)
+                front++;
+            size_t back = dist.size();
+            while (back > front && dist[back - 1] < TrimBelow)
+                back--;
+            dist.erase(dist.begin() + back, dist.end());
+            dist.erase(dist.begin(), dist.begin() + front);
+            base += static_cast<int64_t>(front);
+        }
+    }
+
+    /**
+     * @brief Retrieves the probability of ruin by the end.
+     *
+     * @return double The probability.
+     */
+    double SessionDistribution::Ruin() const
+    {
+        return ruinByHand.empty() ? 0 : ruinByHand.back();
+    }
+
+    /**
+     * @brief Adds the ruined sessions to the survivors that end below the bankroll.
+     *
+     * @param bankroll The bankroll.
+     * @return double The probability.
+     */
+    double SessionDistribution::Below(double bankroll) const
+    {
+        double total = Ruin();
+        for (size_t i = 0; i < probabilities.size() && lowest + i * step < bankroll - step / 2; i++)
+            total += probabilities[i];
+        return total;
+    }
+
+    /**
+     * @brief Retrieves the mean of the survivors.
+     *
+     * @return double The mean bankroll, 0 when nobody survives.
+     */
+    double SessionDistribution::SurvivorMean() const
+    {
+        double mass = 0;
+        double sum = 0;
+        for (size_t i = 0; i < probabilities.size(); i++)
+        {
+            mass += probabilities[i];
+            sum += probabilities[i] * (lowest + i * step);
+        }
+        return mass > 0 ? sum / mass : 0;
+    }
+
+    /**
+     * @brief Construct a RuinCalculator, laying the outcomes out on the lattice.
+     *
+     * @param outcomes Result of one hand in bet units.
+     * @param weights How often each outcome happens.
+     * @param step Lattice step, 0 to find one.
+     */
+    RuinCalculator::RuinCalculator(const vector<double> &outcomes, const vector<double> &weights, double step)
+        : _step(step), _lowestOutcome(0)
+    {
+        if (outcomes.empty() || outcomes.size() != weights.size())
+            throw runtime_error("Outcomes and weights must be the same non-empty size");
+
+        auto fits = [&](double candidate)
+        {
+            for (double outcome : outcomes)
+            {
+                double steps = outcome / candidate;
+                if (fabs(steps - round(steps)) > 1e-9)
+                    return false;
+            }
+            return true;
+        };
+        if (_step <= 0)
+        {
+            const double candidates[] = {1, 0.5, 0.25, 0.2, 0.1, 0.05, 0.01};
+            for (double candidate : candidates)
+            {
+                if (fits(candidate))
+                {
+                    _step = candidate;
+                    break;
+                }
+            }
+        }
+        if (_step <= 0 || !fits(_step))
+            throw runtime_error("Outcomes are not on the lattice");
+
+        int64_t lowest = INT64_MAX;
+        int64_t highest = INT64_MIN;
+        for (double outcome : outcomes)
+        {
+            int64_t steps = llround(outcome / _step);
+            lowest = min(lowest, steps);
+            highest = max(highest, steps);
+        }
+        _lowestOutcome = lowest;
+        _kernel.assign(static_cast<size_t>(highest - lowest + 1), 0.0);
+
+        double total = 0;
+        for (size_t i = 0; i < outcomes.size(); i++)
+        {
+            if (weights[i] < 0)
+                throw runtime_error("Weights cannot be negative");
+            _kernel[llround(outcomes[i] / _step) - lowest] += weights[i];
+            total += weights[i];
+        }
+        if (total <= 0)
+            throw runtime_error("Weights add up to nothing");
+        for (double &p : _kernel)
+            p /= total;
+    }
+
+    /**
+     * @brief Retrieves the lattice step.
+     *
+     * @return double The step.
+     */
+    double RuinCalculator::Step() const
+    {
+        return _step;
+    }
+
+    /**
+     * @brief Advances the distribution a block of k hands at a time. k balances the FFT of the
+     *        whole distribution, paid once a block, against stepping the band of width k worst
+     *        losses above the barrier, paid every hand: about sqrt(FFT work / (loss * taps)).
+     *        When no hand can lose, the barrier is never reached and one block covers it all.
+     *
+     * @param bankroll Bankroll at the start.
+     * @param hands Hands in the session.
+     * @param floor Bankrolls below this are ruined.
+     * @return SessionDistribution The distribution.
+     */
+    SessionDistribution RuinCalculator::Session(double bankroll, uint64_t hands, double floor) const
+    {
+        SessionDistribution result;
+        result.step = _step;
+        result.ruinByHand.assign(hands, 0.0);
+
+        const int64_t barrier = static_cast<int64_t>(ceil(floor / _step - 1e-9));
+        const int64_t taps = static_cast<int64_t>(_kernel.size());
+        const int64_t worstLoss = max<int64_t>(0, -_lowestOutcome);
+        int64_t base = llround(bankroll / _step);
+        if (base < barrier)
+        {
+            result.ruinByHand.assign(hands, 1.0);
+            result.lowest = base * _step;
+            return result;
+        }
+
+        vector<double> live(1, 1.0);
+        vector<double> near;
+        vector<double> stepped;
+        // k-fold spectra by block size and FFT size, the block size only changes when the FFT grows
+        map<pair<uint64_t, size_t>, vector<complex<double>>> spectra;
+        double ruin = 0;
+        uint64_t hand = 0;
+        while (hand < hands)
+        {
+            const uint64_t remaining = hands - hand;
+            uint64_t block = remaining;
+            if (worstLoss > 0)
+            {
+                double fftSize = static_cast<double>(powerOfTwo(live.size() + taps));
+                double balanced = sqrt(15 * fftSize * log2(fftSize) / (worstLoss * taps));
+                block = min<uint64_t>(remaining, max<uint64_t>(1, static_cast<uint64_t>(balanced)));
+            }
+
+            // live[split] is the first bankroll the block cannot ruin
+            int64_t split = worstLoss == 0 ? 0 : barrier + static_cast<int64_t>(block) * worstLoss - base;
+            split = max<int64_t>(0, min<int64_t>(split, static_cast<int64_t>(live.size())));
+
+            vector<double> far;
+            int64_t farBase = 0;
+            if (split < static_cast<int64_t>(live.size()))
+            {
+                // One forward and one inverse FFT a block, the k-fold spectrum comes from the cache
+                const size_t count = live.size() - split + block * (taps - 1);
+                const size_t size = powerOfTwo(count);
+                vector<complex<double>> &power = spectra[make_pair(block, size)];
+                if (power.empty())
+                    power = kernelPowerSpectrum(_kernel, block, size);
+
+                vector<complex<double>> spectrum(size);
+                copy(live.begin() + split, live.end(), spectrum.begin());
+                fft(spectrum, false);
+                for (size_t i = 0; i < size; i++)
+                    spectrum[i] *= power[i];
+                far = inverseToProbabilities(spectrum, count);
+                farBase = base + split + static_cast<int64_t>(block) * _lowestOutcome;
+            }
+
+            near.assign(live.begin(), live.begin() + split);
+            int64_t nearBase = base;
+            for (uint64_t i = 0; i < block; i++)
+            {
+                if (!near.empty())
+                {
+                    stepped.assign(near.size() + taps - 1, 0.0);
+                    for (size_t from = 0; from < near.size(); from++)
+                    {
+                        if (near[from] == 0)
+                            continue;
+                        for (int64_t tap = 0; tap < taps; tap++)
+                            stepped[from + tap] += near[from] * _kernel[tap];
+                    }
+                    nearBase += _lowestOutcome;
+                    int64_t fallen = min<int64_t>(max<int64_t>(0, barrier - nearBase), static_cast<int64_t>(stepped.size()));
+                    for (int64_t j = 0; j < fallen; j++)
+                        ruin += stepped[j];
+                    near.assign(stepped.begin() + fallen, stepped.end());
+                    nearBase += fallen;
+                }
+                result.ruinByHand[hand + i] = ruin;
+            }
+
+            if (near.empty())
+            {
+                live.swap(far);
+                base = farBase;
+            }
+            else if (far.empty())
+            {
+                live.swap(near);
+                base = nearBase;
+            }
+            else
+            {
+                int64_t low = min(nearBase, farBase);
+                int64_t high = max(nearBase + static_cast<int64_t>(near.size()), farBase + static_cast<int64_t>(far.size()));
+                live.assign(static_cast<size_t>(high - low), 0.0);
+                for (size_t i = 0; i < near.size(); i++)
+                    live[nearBase - low + i] += near[i];
+                for (size_t i = 0; i < far.size(); i++)
+                    live[farBase - low + i] += far[i];
+                base = low;
+            }
+            trim(live, base);
+            hand += block;
+            if (live.empty())
+            {
+                for (uint64_t rest = hand; rest < hands; rest++)
+                    result.ruinByHand[rest] = ruin;
+                break;
+            }
+        }
+
+        result.lowest = base * _step;
+        result.probabilities = live;
+        return result;
+    }
+
+    /**
+     * @brief Multiplies the spectra of both sequences.
+     *
+     * @param a First sequence.
+     * @param b Second sequence.
+     * @return vector<double> The convolution, negative rounding noise cleared.
+     */
+    vector<double> RuinCalculator::Convolve(const vector<double> &a, const vector<double> &b)
+    {
+        if (a.empty() || b.empty())
+            return vector<double>();
+        const size_t count = a.size() + b.size() - 1;
+        vector<complex<double>> left(powerOfTwo(count));
+        vector<complex<double>> right(left.size());
+        copy(a.begin(), a.end(), left.begin());
+        copy(b.begin(), b.end(), right.begin());
+        fft(left, false);
+        fft(right, false);
+        for (size_t i = 0; i < left.size(); i++)
+            left[i] *= right[i];
+        return inverseToProbabilities(left, count);
+    }
+}
@@ -0,0 +1,365 @@
+/**
+ * @file ShuffleKernel.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief ShuffleKernel class implementation, which shuffles many shoes at once into one contiguous buffer.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <stdexcept>
+#include <Philox.h>
+#include <ShuffleKernel.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        uint32_t rotl(uint32_t x, int k)
+        {
+            return (x << k) | (x >> (32 - k));
+        }
+
+        uint64_t splitMix64(uint64_t &state)
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        /// @brief Philox blocks each lane buffers at a time, 64 numbers, more than a one deck shoe needs
+        const int LaneBlocks = 16;
+        const int LaneWords = LaneBlocks * 4;
+
+        // The Philox streams of Lanes rounds, read like one PhiloxStream per lane
+        struct PhiloxLanes
+        {
+            uint32_t key0;
+            uint32_t key1;
+            uint64_t round[ShuffleKernel::Lanes];
+            uint64_t block[ShuffleKernel::Lanes];
+            uint32_t words[ShuffleKernel::Lanes][LaneWords];
+            int used[ShuffleKernel::Lanes];
+
+            PhiloxLanes(uint64_t seed, uint64_t firstRound)
+                : key0(static_cast<uint32_t>(seed)), key1(static_cast<uint32_t>(seed >> 32))
+            {
+                for (int lane = 0; lane < ShuffleKernel::Lanes; lane++)
+                {
+                    round[lane] = firstRound + lane;
+                    block[lane] = 0;
+                    used[lane] = LaneWords;
+                }
+            }
+
+            // Refill every lane at once, block by block with the lanes innermost
+            void refillAll()
+            {
+                for (int b = 0; b < LaneBlocks; b++)
+                {
+                    for (int lane = 0; lane < ShuffleKernel::Lanes; lane++)
+                    {
+                        uint32_t *counter = &words[lane][b * 4];
+                        uint64_t index = block[lane] + b;
+                        counter[0] = static_cast<uint32_t>(index);
+                        counter[1] = static_cast<uint32_t>(index >> 32);
+                        counter[2] = static_cast<uint32_t>(round[lane]);
+                        counter[3] = static_cast<uint32_t>(round[lane] >> 32);
+                        Philox4x32(counter, key0, key1);
+                    }
+                }
+                for (int lane = 0; lane < ShuffleKernel::Lanes; lane++)
+                {
+                    block[lane] += LaneBlocks;
+                    used[lane] = 0;
+                }
+            }
+
+            // Refill one lane that redraws put ahead of the others
+            void refill(int lane)
+            {
+                for (int b = 0; b < LaneBlocks; b++)
+                {
+                    uint32_t *counter = &words[lane][b * 4];
+                    uint64_t index = block[lane] + b;
+                    counter[0] = static_cast<uint32_t>(index);
+                    counter[1] = static_cast<uint32_t>(index >> 32);
+                    counter[2] = static_cast<uint32_t>(round[lane]);
+                    counter[3] = static_cast<uint32_t>(round[lane] >> 32);
+                    Philox4x32(counter, key0, key1);
+                }
+                block[lane] += LaneBlocks;
+                used[lane] = 0;
+            }
+
+            uint32_t next(int lane)
+            {
+                if (used[lane] == LaneWords)
+                    refill(lane);
+                return words[lane][used[lane]++];
+            }
+        };
+    }
+
+    /**
+     * @brief Construct a new ShuffleKernel. Each lane gets its own 128 bit state from a
+     *        splitmix64 sequence, so the lanes never share a stream.
+     *
+     * @param seed Seed for all lanes.
+     */
+    ShuffleKernel::ShuffleKernel(uint64_t seed)
+    {
+        uint64_t state = seed;
+        for (int lane = 0; lane < Lanes; lane++)
+        {
+            uint64_t a = splitMix64(state);
+            uint64_t b = splitMix64(state);
+            _s0[lane] = static_cast<uint32_t>(a);
+            _s1[lane] = static_cast<uint32_t>(a >> 32);
+            _s2[lane] = static_cast<uint32_t>(b);
+            _s3[lane] = static_cast<uint32_t>(b >> 32);
+        }
+    }
+
+    /**
+     * @brief Advances all lanes one step. The loop body has no branches so it is vectorized.
+     *
+     * @param out One output per lane.
+     */
+    void ShuffleKernel::nextLanes(uint32_t *out)
+    {
+        for (int lane = 0; lane < Lanes; lane++)
+        {
+            out[lane] = rotl(_s1[lane] * 5, 7) * 9;
+            uint32_t t = _s1[lane] << 9;
+            _s2[lane] ^= _s0[lane];
+            _s3[lane] ^= _s1[lane];
+            _s1[lane] ^= _s2[lane];
+            _s0[lane] ^= _s3[lane];
+            _s2[lane] ^= t;
+            _s3[lane] = rotl(_s3[lane], 11);
+        }
+    }
+
+    /**
+     * @brief Advances one lane one step.
+     *
+     * @param lane Lane to advance.
+     * @return uint32_t Next output of that lane.
+     */
+    uint32_t ShuffleKernel::nextLane(int lane)
+    {
+        uint32_t result = rotl(_s1[lane] * 5, 7) * 9;
+        uint32_t t = _s1[lane] << 9;
+        _s2[lane] ^= _s0[lane];
+        _s3[lane] ^= _s1[lane];
+        _s1[lane] ^= _s2[lane];
+        _s0[lane] ^= _s3[lane];
+        _s2[lane] ^= t;
+        _s3[lane] = rotl(_s3[lane], 11);
+        return result;
+    }
+
+    /**
+     * @brief Fills a shoe with unshuffled decks, Clubs Ace - King first, Spades last.
+     *
+     * @param shoe Buffer to fill.
+     * @param decksPerShoe Number of decks in the shoe.
+     */
+    void ShuffleKernel::FillOrdered(uint8_t *shoe, int decksPerShoe)
+    {
+        for (int d = 0; d < decksPerShoe; d++)
+        {
+            for (int i = 0; i < CardsPerDeck; i++)
+            {
+                shoe[d * CardsPerDeck + i] = static_cast<uint8_t>(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Fisher-Yates shuffle of one round's shoe driven by the round's Philox stream.
+     *
+     * @param seed Seed of the run.
+     * @param round Round index, the Philox stream number.
+     * @param shoe Buffer to fill and shuffle.
+     * @param decksPerShoe Number of decks in the shoe.
+     * @throws runtime_error if decksPerShoe is less than 1.
+     */
+    void ShuffleKernel::ShuffleRound(uint64_t seed, uint64_t round, uint8_t *shoe, int decksPerShoe)
+    {
+        if (decksPerShoe < 1)
+            throw std::runtime_error("A shoe needs at least one deck");
+
+        FillOrdered(shoe, decksPerShoe);
+        PhiloxStream stream(seed, round);
+        for (uint32_t i = CardsPerDeck * decksPerShoe - 1; i > 0; i--)
+        {
+            uint32_t j = stream.Bounded(i + 1);
+            uint8_t temp = shoe[i];
+            shoe[i] = shoe[j];
+            shoe[j] = temp;
+        }
+    }
+
+    /**
+     * @brief Shuffles the shoes Lanes at a time. For each Fisher-Yates step all lanes draw
+     *        together, then the rare draws that fall in the biased zone are redrawn per lane.
+     *
+     * @param out Buffer for shoes * 52 * decksPerShoe card codes.
+     * @param shoes Number of shoes.
+     * @param decksPerShoe Number of decks per shoe.
+     * @throws runtime_error if shoes is negative or decksPerShoe is less than 1.
+     */
+    void ShuffleKernel::ShuffleBatch(uint8_t *out, int shoes, int decksPerShoe)
+    {
+        if (shoes < 0)
+            throw std::runtime_error("Number of shoes can not be negative");
+        if (decksPerShoe < 1)
+            throw std::runtime_error("A shoe needs at least one deck");
+
+        const int shoeSize = CardsPerDeck * decksPerShoe;
+        uint32_t random[Lanes];
+        uint32_t index[Lanes];
+
+        for (int first = 0; first < shoes; first += Lanes)
+        {
+            int active = shoes - first < Lanes ? shoes - first : Lanes;
+            uint8_t *group = out + static_cast<size_t>(first) * shoeSize;
+
+            for (int lane = 0; lane < active; lane++)
+            {
+                FillOrdered(group + static_cast<size_t>(lane) * shoeSize, decksPerShoe);
+            }
+
+            for (uint32_t i = shoeSize - 1; i > 0; i--)
+            {
+                const uint32_t range = i + 1;
+                bool rejected = false;
+                nextLanes(random);
+                for (int lane = 0; lane < Lanes; lane++)
+                {
+                    uint64_t m = static_cast<uint64_t>(random[lane]) * range;
+                    index[lane] = static_cast<uint32_t>(m >> 32);
+                    rejected |= static_cast<uint32_t>(m) < range;
+                }
+
+                // Only values whose low word is under range can be biased, check those exactly
+                if (rejected)
+                {
+                    const uint32_t threshold = (0u - range) % range;
+                    for (int lane = 0; lane < active; lane++)
+                    {
+                        uint64_t m = static_cast<uint64_t>(random[lane]) * range;
+                        while (static_cast<uint32_t>(m) < threshold)
+                        {
+                            m = static_cast<uint64_t>(nextLane(lane)) * range;
+                        }
+                        index[lane] = static_cast<uint32_t>(m >> 32);
+                    }
+                }
+
+                for (int lane = 0; lane < active; lane++)
+                {
+                    uint8_t *shoe = group + static_cast<size_t>(lane) * shoeSize;
+                    uint8_t temp = shoe[i];
+                    shoe[i] = shoe[index[lane]];
+                    shoe[index[lane]] = temp;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Shuffles Lanes rounds at a time. For each Fisher-Yates step every lane takes the
+     *        next number of its round's stream together; the rare draws that fall in the biased
+     *        zone are redrawn per lane, exactly as PhiloxStream::Bounded does, so each shoe
+     *        matches ShuffleRound.
+     *
+     * @param seed Seed of the run.
+     * @param firstRound Round of the first shoe.
+     * @param out Buffer for shoes * 52 * decksPerShoe card codes.
+     * @param shoes Number of shoes.
+     * @param decksPerShoe Number of decks per shoe.
+     * @throws runtime_error if shoes is negative or decksPerShoe is less than 1.
+     */
+    void ShuffleKernel::ShuffleRounds(uint64_t seed, uint64_t firstRound, uint8_t *out, int shoes, int decksPerShoe)
+    {
+        if (shoes < 0)
+            throw std::runtime_error("Number of shoes can not be negative");
+        if (decksPerShoe < 1)
+            throw std::runtime_error("A shoe needs at least one deck");
+
+        const int shoeSize = CardsPerDeck * decksPerShoe;
+        uint32_t index[Lanes];
+
+        for (int first = 0; first < shoes; first += Lanes)
+        {
+            int active = shoes - first < Lanes ? shoes - first : Lanes;
+            uint8_t *group = out + static_cast<size_t>(first) * shoeSize;
+            PhiloxLanes streams(seed, firstRound + first);
+
+            for (int lane = 0; lane < active; lane++)
+            {
+                FillOrdered(group + static_cast<size_t>(lane) * shoeSize, decksPerShoe);
+            }
+
+            for (uint32_t i = shoeSize - 1; i > 0; i--)
+            {
+                const uint32_t range = i + 1;
+                bool empty = false;
+                for (int lane = 0; lane < Lanes; lane++)
+                    empty |= streams.used[lane] == LaneWords;
+                if (empty)
+                {
+                    bool allEmpty = true;
+                    for (int lane = 0; lane < Lanes; lane++)
+                        allEmpty &= streams.used[lane] == LaneWords;
+                    if (allEmpty)
+                        streams.refillAll();
+                    else
+                    {
+                        for (int lane = 0; lane < Lanes; lane++)
+                        {
+                            if (streams.used[lane] == LaneWords)
+                                streams.refill(lane);
+                        }
+                    }
+                }
+
+                bool rejected = false;
+                for (int lane = 0; lane < Lanes; lane++)
+                {
+                    uint64_t m = static_cast<uint64_t>(streams.words[lane][streams.used[lane]++]) * range;
+                    index[lane] = static_cast<uint32_t>(m >> 32);
+                    rejected |= static_cast<uint32_t>(m) < range;
+                }
+
+                // Only values whose low word is under range can be biased, check those exactly
+                if (rejected)
+                {
+                    const uint32_t threshold = (0u - range) % range;
+                    for (int lane = 0; lane < active; lane++)
+                    {
+                        uint64_t m = static_cast<uint64_t>(streams.words[lane][streams.used[lane] - 1]) * range;
+                        while (static_cast<uint32_t>(m) < threshold)
+                        {
+                            m = static_cast<uint64_t>(streams.next(lane)) * range;
+                        }
+                        index[lane] = static_cast<uint32_t>(m >> 32);
+                    }
+                }
+
+                for (int lane = 0; lane < active; lane++)
+                {
+                    uint8_t *shoe = group + static_cast<size_t>(lane) * shoeSize;
+                    uint8_t temp = shoe[i];
+                    shoe[i] = shoe[index[lane]];
+                    shoe[index[lane]] = temp;
+                }
+            }
+        }
+    }
+}
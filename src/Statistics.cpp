@@ -0,0 +1,327 @@
+/**
+ * @file Statistics.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Implementation of RunningStats and SimulationStats, the mergeable statistics of a simulation.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <Statistics.h>
+
+namespace chants
+{
+
+    /**
+     * @brief Construct an empty RunningStats.
+     */
+    RunningStats::RunningStats() : _count(0), _mean(0), _m2(0)
+    {
+    }
+
+    /**
+     * @brief Adds a value with Welford's update, which stays accurate over billions of values.
+     *
+     * @param value Value to add.
+     */
+    void RunningStats::Add(double value)
+    {
+        _count++;
+        double delta = value - _mean;
+        _mean += delta / _count;
+        _m2 += delta * (value - _mean);
+    }
+
+    /**
+     * @brief Combines two streams with Chan's formula.
+     *
+     * @param other Statistics of the other stream.
+     */
+    void RunningStats::Merge(const RunningStats &other)
+    {
+        if (other._count == 0)
+            return;
+        if (_count == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        uint64_t count = _count + other._count;
+        double delta = other._mean - _mean;
+        _mean += delta * other._count / count;
+        _m2 += other._m2 + delta * delta * (static_cast<double>(_count) * other._count / count);
+        _count = count;
+    }
+
+    /**
+     * @brief Retrieves the number of values.
+     *
+     * @return uint64_t Number of values.
+     */
+    uint64_t RunningStats::Count() const
+    {
+        return _count;
+    }
+
+    /**
+     * @brief Retrieves the mean.
+     *
+     * @return double Mean of the values.
+     */
+    double RunningStats::Mean() const
+    {
+        return _mean;
+    }
+
+    /**
+     * @brief Retrieves the sample variance.
+     *
+     * @return double Sample variance of the values.
+     */
+    double RunningStats::Variance() const
+    {
+        if (_count < 2)
+            return 0;
+        return _m2 / (_count - 1);
+    }
+
+    /**
+     * @brief Computes z times the standard error of the mean.
+     *
+     * @param z Normal quantile.
+     * @return double Half width of the confidence interval.
+     */
+    double RunningStats::HalfWidth(double z) const
+    {
+        if (_count < 2)
+            return INFINITY;
+        return z * std::sqrt(Variance() / _count);
+    }
+
+    /**
+     * @brief Construct empty statistics for a number of seats.
+     *
+     * @param seats Number of seats.
+     */
+    SimulationStats::SimulationStats(int seats)
+    {
+        if (seats < 1)
+            throw runtime_error("Statistics need at least one seat");
+
+        _seats = seats;
+        _scores.resize(static_cast<size_t>(seats) * (MaxScore + 1));
+        _busts.resize(seats);
+        _thresholdRounds.resize(22);
+        _thresholdBusts.resize(22);
+        _leadingStreak.resize(seats);
+        _currentStreak.resize(seats);
+        _longestStreak.resize(seats);
+        _winStats.resize(seats);
+        _scoreStats.resize(seats);
+        Clear();
+    }
+
+    /**
+     * @brief Clears every counter without releasing memory, so a per-batch instance can be reused.
+     */
+    void SimulationStats::Clear()
+    {
+        _rounds = 0;
+        std::fill(_scores.begin(), _scores.end(), 0);
+        std::fill(_busts.begin(), _busts.end(), 0);
+        std::fill(_thresholdRounds.begin(), _thresholdRounds.end(), 0);
+        std::fill(_thresholdBusts.begin(), _thresholdBusts.end(), 0);
+        std::fill(_leadingStreak.begin(), _leadingStreak.end(), 0);
+        std::fill(_currentStreak.begin(), _currentStreak.end(), 0);
+        std::fill(_longestStreak.begin(), _longestStreak.end(), 0);
+        std::fill(_winStats.begin(), _winStats.end(), RunningStats());
+        std::fill(_scoreStats.begin(), _scoreStats.end(), RunningStats());
+    }
+
+    /**
+     * @brief Adds the results of one round to every statistic.
+     *
+     * @param results One result per seat.
+     * @param thresholds Threshold of each seat.
+     */
+    void SimulationStats::AddRound(const SeatResult *results, const int *thresholds)
+    {
+        for (int i = 0; i < _seats; i++)
+        {
+            const SeatResult &result = results[i];
+            int score = result.score > MaxScore ? MaxScore : result.score;
+            _scores[static_cast<size_t>(i) * (MaxScore + 1) + score]++;
+            _busts[i] += result.isBusted;
+            _thresholdRounds[thresholds[i]]++;
+            _thresholdBusts[thresholds[i]] += result.isBusted;
+
+            if (result.isWinner)
+            {
+                // The leading streak only grows while every round so far was a win
+                if (_leadingStreak[i] == _rounds)
+                    _leadingStreak[i]++;
+                _currentStreak[i]++;
+                if (_currentStreak[i] > _longestStreak[i])
+                    _longestStreak[i] = _currentStreak[i];
+            }
+            else
+            {
+                _currentStreak[i] = 0;
+            }
+
+            _winStats[i].Add(result.isWinner ? 1 : 0);
+            _scoreStats[i].Add(result.score);
+        }
+        _rounds++;
+    }
+
+    /**
+     * @brief Merges another stream. Counters add up, the running statistics use Chan's formula
+     *        and a streak can continue from the end of this stream into the start of the other.
+     *
+     * @param other Statistics to add.
+     */
+    void SimulationStats::Merge(const SimulationStats &other)
+    {
+        if (other._seats != _seats)
+            throw runtime_error("Can not merge statistics of a different number of seats");
+
+        for (size_t i = 0; i < _scores.size(); i++)
+            _scores[i] += other._scores[i];
+        for (size_t i = 0; i < _thresholdRounds.size(); i++)
+        {
+            _thresholdRounds[i] += other._thresholdRounds[i];
+            _thresholdBusts[i] += other._thresholdBusts[i];
+        }
+
+        for (int i = 0; i < _seats; i++)
+        {
+            _busts[i] += other._busts[i];
+
+            uint64_t joined = _currentStreak[i] + other._leadingStreak[i];
+            uint64_t longest = _longestStreak[i] > other._longestStreak[i] ? _longestStreak[i] : other._longestStreak[i];
+            _longestStreak[i] = joined > longest ? joined : longest;
+            if (_leadingStreak[i] == _rounds)
+                _leadingStreak[i] += other._leadingStreak[i];
+            if (other._currentStreak[i] == other._rounds)
+                _currentStreak[i] += other._currentStreak[i];
+            else
+                _currentStreak[i] = other._currentStreak[i];
+
+            _winStats[i].Merge(other._winStats[i]);
+            _scoreStats[i].Merge(other._scoreStats[i]);
+        }
+        _rounds += other._rounds;
+    }
+
+    /**
+     * @brief Retrieves the number of seats.
+     *
+     * @return int Number of seats.
+     */
+    int SimulationStats::Seats() const
+    {
+        return _seats;
+    }
+
+    /**
+     * @brief Retrieves the number of rounds.
+     *
+     * @return uint64_t Number of rounds added.
+     */
+    uint64_t SimulationStats::Rounds() const
+    {
+        return _rounds;
+    }
+
+    /**
+     * @brief Retrieves one bucket of a seat's score histogram.
+     *
+     * @param seat Seat index.
+     * @param score Final score.
+     * @return uint64_t Number of rounds the seat finished with the score.
+     */
+    uint64_t SimulationStats::ScoreCount(int seat, int score) const
+    {
+        return _scores[static_cast<size_t>(seat) * (MaxScore + 1) + score];
+    }
+
+    /**
+     * @brief Retrieves the number of busts of a seat.
+     *
+     * @param seat Seat index.
+     * @return uint64_t Number of busts.
+     */
+    uint64_t SimulationStats::Busts(int seat) const
+    {
+        return _busts[seat];
+    }
+
+    /**
+     * @brief Computes the bust rate of every seat round played with a threshold.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @return double Bust rate.
+     */
+    double SimulationStats::BustRateAtThreshold(int threshold) const
+    {
+        if (_thresholdRounds[threshold] == 0)
+            return 0;
+        return static_cast<double>(_thresholdBusts[threshold]) / _thresholdRounds[threshold];
+    }
+
+    /**
+     * @brief Retrieves the longest win streak of a seat.
+     *
+     * @param seat Seat index.
+     * @return uint64_t Longest run of wins.
+     */
+    uint64_t SimulationStats::LongestWinStreak(int seat) const
+    {
+        return _longestStreak[seat];
+    }
+
+    /**
+     * @brief Retrieves the win statistics of a seat.
+     *
+     * @param seat Seat index.
+     * @return const RunningStats& Win indicator statistics.
+     */
+    const RunningStats &SimulationStats::Wins(int seat) const
+    {
+        return _winStats[seat];
+    }
+
+    /**
+     * @brief Retrieves the score statistics of a seat.
+     *
+     * @param seat Seat index.
+     * @return const RunningStats& Final score statistics.
+     */
+    const RunningStats &SimulationStats::Scores(int seat) const
+    {
+        return _scoreStats[seat];
+    }
+
+    /**
+     * @brief Checks the confidence interval of every seat's win rate against the target.
+     *
+     * @param stop Early stop settings.
+     * @return true if the run can stop.
+     */
+    bool SimulationStats::ReachedPrecision(const EarlyStop &stop) const
+    {
+        if (stop.halfWidth <= 0 || _rounds < stop.minRounds)
+            return false;
+        for (int i = 0; i < _seats; i++)
+        {
+            if (_winStats[i].HalfWidth(stop.z) > stop.halfWidth)
+                return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,487 @@
+/**
+ * @file StrategySolver.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief StrategySolver implementation, the expected value recursion behind basic strategy.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <StrategySolver.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Rows per table, indexed directly by total
+        const int Rows = StrategySolver::MaxTotal + 1;
+        /// @brief Dealer finishes 17 - 21 then bust
+        const int DealerOutcomes = 6;
+        const int DealerBust = 5;
+
+        // Add a card to a (total, soft) state, counting at most one Ace as 11.
+        void addCard(int &total, bool &soft, int points)
+        {
+            int softAces = (soft ? 1 : 0) + (points == 11 ? 1 : 0);
+            total += points;
+            while (total > 21 && softAces > 0)
+            {
+                total -= 10;
+                softAces--;
+            }
+            soft = softAces > 0;
+        }
+
+        int standIndex(int upcard, int total)
+        {
+            return (upcard - 2) * Rows + total;
+        }
+
+        int handIndex(int upcard, bool soft, int total)
+        {
+            return ((upcard - 2) * 2 + (soft ? 1 : 0)) * Rows + total;
+        }
+
+        int splitIndex(int upcard, int pairCard)
+        {
+            return (upcard - 2) * 12 + pairCard;
+        }
+
+        // Everything solved for one upcard. Each solve owns one, so threads share nothing.
+        struct UpcardSolve
+        {
+            const StrategyRules &rules;
+            /// @brief Chance of each card 2 - 11 at index points - 2
+            double chance[10];
+            /// @brief Dealer finishes from a (total, soft) state, memoized
+            double dealer[2][32][DealerOutcomes];
+            bool dealerDone[2][32];
+            /// @brief Dealer finishes from the upcard, given no dealer blackjack
+            double final[DealerOutcomes];
+            double stand[Rows];
+            /// @brief Best of stand and hit, memoized, and the hit part of it
+            double best[2][Rows];
+            double hit[2][Rows];
+            bool bestDone[2][Rows];
+
+            UpcardSolve(const StrategyRules &solveRules, int upcard) : rules(solveRules)
+            {
+                // The shoe less the upcard; later cards keep these chances
+                double counts[10];
+                for (int i = 0; i < 10; i++)
+                    counts[i] = 4.0 * rules.decks;
+                counts[8] = 16.0 * rules.decks;
+                counts[upcard - 2] -= 1;
+                double cards = 52.0 * rules.decks - 1;
+                for (int i = 0; i < 10; i++)
+                    chance[i] = counts[i] / cards;
+
+                fill(&dealerDone[0][0], &dealerDone[0][0] + 2 * 32, false);
+                fill(&bestDone[0][0], &bestDone[0][0] + 2 * Rows, false);
+            }
+
+            const double *dealerFrom(int total, bool soft)
+            {
+                double *out = dealer[soft][total];
+                if (dealerDone[soft][total])
+                    return out;
+                dealerDone[soft][total] = true;
+
+                fill(out, out + DealerOutcomes, 0.0);
+                if (total > 21)
+                {
+                    out[DealerBust] = 1;
+                    return out;
+                }
+                if (total > 17 || (total == 17 && !(soft && rules.dealerHitsSoft17)))
+                {
+                    out[total - 17] = 1;
+                    return out;
+                }
+
+                for (int c = 0; c < 10; c++)
+                {
+                    int next = total;
+                    bool nextSoft = soft;
+                    addCard(next, nextSoft, c + 2);
+                    const double *after = dealerFrom(next, nextSoft);
+                    for (int o = 0; o < DealerOutcomes; o++)
+                        out[o] += chance[c] * after[o];
+                }
+                return out;
+            }
+
+            void solveDealer(int upcard)
+            {
+                // The dealer peeked, so the hole card cannot complete a blackjack
+                int excluded = upcard == 11 ? 8 : (upcard == 10 ? 9 : -1);
+                double mass = 0;
+                for (int c = 0; c < 10; c++)
+                {
+                    if (c != excluded)
+                        mass += chance[c];
+                }
+
+                fill(final, final + DealerOutcomes, 0.0);
+                for (int c = 0; c < 10; c++)
+                {
+                    if (c == excluded)
+                        continue;
+                    int total = upcard;
+                    bool soft = upcard == 11;
+                    addCard(total, soft, c + 2);
+                    const double *after = dealerFrom(total, soft);
+                    for (int o = 0; o < DealerOutcomes; o++)
+                        final[o] += chance[c] / mass * after[o];
+                }
+
+                for (int total = 0; total < Rows; total++)
+                {
+                    double value = final[DealerBust];
+                    for (int dealerTotal = 17; dealerTotal <= 21; dealerTotal++)
+                    {
+                        if (dealerTotal < total)
+                            value += final[dealerTotal - 17];
+                        else if (dealerTotal > total)
+                            value -= final[dealerTotal - 17];
+                    }
+                    stand[total] = value;
+                }
+            }
+
+            double standValue(int total) const
+            {
+                return total > 21 ? -1.0 : stand[total];
+            }
+
+            // Best of standing and hitting, where every hit is a state with a higher hard count,
+            // so the recursion ends.
+            double bestValue(int total, bool soft)
+            {
+                if (total > 21)
+                    return -1.0;
+                if (bestDone[soft][total])
+                    return best[soft][total];
+
+                double value = 0;
+                for (int c = 0; c < 10; c++)
+                {
+                    int next = total;
+                    bool nextSoft = soft;
+                    addCard(next, nextSoft, c + 2);
+                    value += chance[c] * bestValue(next, nextSoft);
+                }
+                hit[soft][total] = value;
+                best[soft][total] = max(standValue(total), value);
+                bestDone[soft][total] = true;
+                return best[soft][total];
+            }
+
+            double doubleValue(int total, bool soft) const
+            {
+                double value = 0;
+                for (int c = 0; c < 10; c++)
+                {
+                    int next = total;
+                    bool nextSoft = soft;
+                    addCard(next, nextSoft, c + 2);
+                    value += chance[c] * standValue(next);
+                }
+                return 2 * value;
+            }
+
+            double splitValue(int pairCard)
+            {
+                double hand = 0;
+                for (int c = 0; c < 10; c++)
+                {
+                    int total = pairCard;
+                    bool soft = pairCard == 11;
+                    addCard(total, soft, c + 2);
+                    double value;
+                    if (pairCard == 11)
+                        value = standValue(total);
+                    else
+                    {
+                        value = bestValue(total, soft);
+                        if (rules.doubleAfterSplit)
+                            value = max(value, doubleValue(total, soft));
+                    }
+                    hand += chance[c] * value;
+                }
+                return 2 * hand;
+            }
+        };
+
+        // The total of a starting pair, soft 12 for Aces
+        int pairTotal(int pairCard)
+        {
+            return pairCard == 11 ? 12 : 2 * pairCard;
+        }
+
+        bool validState(int total, bool soft)
+        {
+            return total >= (soft ? 12 : 4) && total <= 21;
+        }
+    }
+
+    const int StrategySolver::MaxTotal;
+    const int StrategySolver::Upcards;
+
+    /**
+     * @brief Construct a new StrategySolver. Nothing is computed until Solve.
+     *
+     * @param rules Table rules.
+     */
+    StrategySolver::StrategySolver(const StrategyRules &rules)
+        : _rules(rules), _solved(false),
+          _stand(Upcards * Rows, 0.0), _hit(Upcards * 2 * Rows, 0.0),
+          _double(Upcards * 2 * Rows, 0.0), _split(Upcards * 12, 0.0)
+    {
+        if (rules.decks < 1)
+            throw runtime_error("Strategy needs at least one deck");
+    }
+
+    /**
+     * @brief Solves the dealer's finishing distribution for the upcard, then every player state
+     *        from it, and copies the results into this upcard's slice of the tables.
+     *
+     * @param upcard Dealer upcard points 2 - 11.
+     */
+    void StrategySolver::solveUpcard(int upcard)
+    {
+        UpcardSolve solve(_rules, upcard);
+        solve.solveDealer(upcard);
+
+        for (int total = 0; total < Rows; total++)
+            _stand[standIndex(upcard, total)] = solve.stand[total];
+
+        for (int soft = 0; soft < 2; soft++)
+        {
+            for (int total = soft ? 12 : 4; total <= MaxTotal; total++)
+            {
+                solve.bestValue(total, soft == 1);
+                _hit[handIndex(upcard, soft == 1, total)] = solve.hit[soft][total];
+                _double[handIndex(upcard, soft == 1, total)] = solve.doubleValue(total, soft == 1);
+            }
+        }
+
+        for (int pairCard = 2; pairCard <= 11; pairCard++)
+            _split[splitIndex(upcard, pairCard)] = solve.splitValue(pairCard);
+    }
+
+    /**
+     * @brief Hands the ten upcards out to worker threads through a shared counter.
+     *
+     * @param threads Number of threads, 0 for one per core.
+     */
+    void StrategySolver::Solve(int threads)
+    {
+        if (threads <= 0)
+            threads = max(1, static_cast<int>(thread::hardware_concurrency()));
+        threads = min(threads, Upcards);
+
+        atomic<int> next(0);
+        auto work = [this, &next]()
+        {
+            for (int i = next.fetch_add(1); i < Upcards; i = next.fetch_add(1))
+                solveUpcard(i + 2);
+        };
+
+        vector<thread> workers;
+        for (int i = 1; i < threads; i++)
+            workers.emplace_back(work);
+        work();
+        for (thread &worker : workers)
+            worker.join();
+        _solved = true;
+    }
+
+    /**
+     * @brief Throws unless Solve has run.
+     */
+    void StrategySolver::checkSolved() const
+    {
+        if (!_solved)
+            throw runtime_error("Strategy has not been solved");
+    }
+
+    /**
+     * @brief Retrieves a solved expected value.
+     *
+     * @param action Stand, hit or double.
+     * @param total Player total.
+     * @param soft True when an Ace counts as 11.
+     * @param upcard Dealer upcard points 2 - 11.
+     * @return double Expected win per unit bet.
+     */
+    double StrategySolver::ExpectedValue(StrategyAction action, int total, bool soft, int upcard) const
+    {
+        checkSolved();
+        if (!validState(total, soft) || upcard < 2 || upcard > 11)
+            throw runtime_error("No such hand state");
+
+        switch (action)
+        {
+        case StrategyStand:
+            return _stand[standIndex(upcard, total)];
+        case StrategyHit:
+            return _hit[handIndex(upcard, soft, total)];
+        case StrategyDouble:
+            return _double[handIndex(upcard, soft, total)];
+        default:
+            throw runtime_error("Use SplitValue for splits");
+        }
+    }
+
+    /**
+     * @brief Retrieves the solved value of splitting a pair.
+     *
+     * @param pairCard Points of one card of the pair, 2 - 11.
+     * @param upcard Dealer upcard points 2 - 11.
+     * @return double Expected win of both hands per unit of the original bet.
+     */
+    double StrategySolver::SplitValue(int pairCard, int upcard) const
+    {
+        checkSolved();
+        if (pairCard < 2 || pairCard > 11 || upcard < 2 || upcard > 11)
+            throw runtime_error("No such pair");
+        return _split[splitIndex(upcard, pairCard)];
+    }
+
+    /**
+     * @brief Picks the action with the highest expected value, standing on ties.
+     *
+     * @param total Player total.
+     * @param soft True when an Ace counts as 11.
+     * @param upcard Dealer upcard points 2 - 11.
+     * @param canDouble True on the first two cards.
+     * @return StrategyAction Stand, hit or double.
+     */
+    StrategyAction StrategySolver::Best(int total, bool soft, int upcard, bool canDouble) const
+    {
+        double stand = ExpectedValue(StrategyStand, total, soft, upcard);
+        double hit = ExpectedValue(StrategyHit, total, soft, upcard);
+        StrategyAction action = hit > stand ? StrategyHit : StrategyStand;
+        if (canDouble && ExpectedValue(StrategyDouble, total, soft, upcard) > max(stand, hit))
+            action = StrategyDouble;
+        return action;
+    }
+
+    /**
+     * @brief Compares splitting against the best play of the pair's total.
+     *
+     * @param pairCard Points of one card of the pair, 2 - 11.
+     * @param upcard Dealer upcard points 2 - 11.
+     * @return true Splitting has the higher expected value.
+     */
+    bool StrategySolver::ShouldSplit(int pairCard, int upcard) const
+    {
+        int total = pairTotal(pairCard);
+        bool soft = pairCard == 11;
+        double unsplit = max(ExpectedValue(StrategyStand, total, soft, upcard),
+                             max(ExpectedValue(StrategyHit, total, soft, upcard),
+                                 ExpectedValue(StrategyDouble, total, soft, upcard)));
+        return SplitValue(pairCard, upcard) > unsplit;
+    }
+
+    /**
+     * @brief Writes the decisions as tables indexed by [total][upcard - 2], so a lookup is one
+     *        array index. Rows outside the reachable totals are filled with hits. The banner has
+     *        no author or date, so regenerating with the same rules gives the same file.
+     *
+     * @param out Stream to write the header to.
+     */
+    void StrategySolver::WriteHeader(ostream &out) const
+    {
+        checkSolved();
+        const char *names[4] = {"S", "H", "D", "P"};
+
+        out << "/**\n"
+            << " * @file BasicStrategy.h\n"
+            << " * @brief Basic strategy for " << _rules.decks << (_rules.decks == 1 ? " deck" : " decks")
+            << ", dealer " << (_rules.dealerHitsSoft17 ? "hits" : "stands on") << " soft 17, "
+            << (_rules.doubleAfterSplit ? "double after split allowed" : "no double after split") << ".\n"
+            << " *        Generated by strategygen from StrategySolver, do not edit by hand.\n"
+            << " *        The solver draws every card after the upcard from one fixed shoe composition, not\n"
+            << " *        removing the player's cards, so a few close plays such as soft 13 against a 5\n"
+            << " *        can differ from published tables for the same rules.\n"
+            << " * @version 1.0\n"
+            << " *\n"
+            << " *\n"
+            << " */\n"
+            << "#pragma once\n\n"
+            << "#include <StrategyAction.h>\n\n"
+            << "namespace chants\n"
+            << "{\n"
+            << "    namespace BasicStrategy\n"
+            << "    {\n"
+            << "        /// @brief Rules the tables were solved for\n"
+            << "        constexpr int Decks = " << _rules.decks << ";\n"
+            << "        constexpr bool DealerHitsSoft17 = " << (_rules.dealerHitsSoft17 ? "true" : "false") << ";\n"
+            << "        constexpr bool DoubleAfterSplit = " << (_rules.doubleAfterSplit ? "true" : "false") << ";\n\n"
+            << "        constexpr StrategyAction S = StrategyStand, H = StrategyHit, D = StrategyDouble;\n"
+            << "        constexpr bool Y = true, N = false;\n";
+
+        auto table = [&](const char *name, const char *brief, bool soft, bool canDouble)
+        {
+            out << "\n        /// @brief " << brief << ", [total][upcard - 2]\n"
+                << "        constexpr StrategyAction " << name << "[" << Rows << "][" << Upcards << "] = {\n"
+                << "            //      2  3  4  5  6  7  8  9  T  A\n";
+            for (int total = 0; total < Rows; total++)
+            {
+                out << "            /* " << (total < 10 ? " " : "") << total << " */ {";
+                for (int upcard = 2; upcard <= 11; upcard++)
+                {
+                    StrategyAction action = validState(total, soft) ? Best(total, soft, upcard, canDouble)
+                                                                    : StrategyHit;
+                    out << names[action] << (upcard < 11 ? ", " : "");
+                }
+                out << "}" << (total < MaxTotal ? "," : "") << "\n";
+            }
+            out << "        };\n";
+        };
+        table("Hard", "Hard totals on the first two cards", false, true);
+        table("Soft", "Soft totals on the first two cards", true, true);
+        table("HardNoDouble", "Hard totals after a hit", false, false);
+        table("SoftNoDouble", "Soft totals after a hit", true, false);
+
+        out << "\n        /// @brief Whether to split a pair, [pair card points][upcard - 2]\n"
+            << "        constexpr bool Split[12][" << Upcards << "] = {\n"
+            << "            //      2  3  4  5  6  7  8  9  T  A\n";
+        for (int pairCard = 0; pairCard < 12; pairCard++)
+        {
+            out << "            /* " << (pairCard < 10 ? " " : "") << pairCard << " */ {";
+            for (int upcard = 2; upcard <= 11; upcard++)
+            {
+                bool split = pairCard >= 2 && ShouldSplit(pairCard, upcard);
+                out << (split ? "Y" : "N") << (upcard < 11 ? ", " : "");
+            }
+            out << "}" << (pairCard < 11 ? "," : "") << "\n";
+        }
+        out << "        };\n"
+            << "    }\n\n"
+            << "    /**\n"
+            << "     * @brief Look up the basic strategy decision for a hand\n"
+            << "     *\n"
+            << "     * @param total - player total 4 - 21\n"
+            << "     * @param soft - true when an Ace counts as 11\n"
+            << "     * @param upcard - dealer upcard points 2 - 11\n"
+            << "     * @param canDouble - true on the first two cards\n"
+            << "     * @param pair - true when the first two cards have the same points\n"
+            << "     * @return StrategyAction\n"
+            << "     */\n"
+            << "    constexpr StrategyAction BasicStrategyAction(int total, bool soft, int upcard, bool canDouble, bool pair = false)\n"
+            << "    {\n"
+            << "        return pair && BasicStrategy::Split[soft ? 11 : total / 2][upcard - 2] ? StrategySplit\n"
+            << "               : canDouble ? (soft ? BasicStrategy::Soft : BasicStrategy::Hard)[total][upcard - 2]\n"
+            << "                           : (soft ? BasicStrategy::SoftNoDouble : BasicStrategy::HardNoDouble)[total][upcard - 2];\n"
+            << "    }\n"
+            << "}\n";
+    }
+}
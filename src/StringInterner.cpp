@@ -0,0 +1,110 @@
+/**
+ * @file StringInterner.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief StringInterner implementation, a linear probing table of names stored in an arena.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <cstdint>
+#include <StringInterner.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Slots in a new table, a power of two
+        const size_t InitialSlots = 64;
+
+        // FNV-1a hash of the characters
+        size_t hashName(const NameView &name)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < name.size(); i++)
+            {
+                hash ^= static_cast<unsigned char>(name.data()[i]);
+                hash *= 1099511628211ull;
+            }
+            return static_cast<size_t>(hash);
+        }
+    }
+
+    /**
+     * @brief Construct an empty StringInterner.
+     *
+     * @param arena Storage of the characters.
+     */
+    StringInterner::StringInterner(MonotonicArena &arena)
+        : _arena(arena), _slots(InitialSlots, NameView(nullptr, 0)), _count(0)
+    {
+    }
+
+    /**
+     * @brief Moves every string to a table twice the size.
+     */
+    void StringInterner::rehash()
+    {
+        vector<NameView> old(_slots.size() * 2, NameView(nullptr, 0));
+        old.swap(_slots);
+        const size_t mask = _slots.size() - 1;
+        for (const NameView &name : old)
+        {
+            if (name.data() == nullptr)
+                continue;
+            size_t slot = hashName(name) & mask;
+            while (_slots[slot].data() != nullptr)
+                slot = (slot + 1) & mask;
+            _slots[slot] = name;
+        }
+    }
+
+    /**
+     * @brief Probes for the string and copies it into the arena when it is new. The table is
+     *        kept at most half full so probes stay short.
+     *
+     * @param text The string.
+     * @return NameView The interned copy.
+     */
+    NameView StringInterner::Intern(NameView text)
+    {
+        const size_t mask = _slots.size() - 1;
+        size_t slot = hashName(text) & mask;
+        while (_slots[slot].data() != nullptr)
+        {
+            if (_slots[slot] == text)
+                return _slots[slot];
+            slot = (slot + 1) & mask;
+        }
+
+        char *copy = _arena.AllocateArray<char>(text.size() + 1);
+        memcpy(copy, text.data(), text.size());
+        copy[text.size()] = '\0';
+        NameView interned(copy, text.size());
+        _slots[slot] = interned;
+        _count++;
+        if (_count * 2 > _slots.size())
+            rehash();
+        return interned;
+    }
+
+    /**
+     * @brief Retrieves the number of distinct strings.
+     *
+     * @return size_t Number of strings.
+     */
+    size_t StringInterner::Count() const
+    {
+        return _count;
+    }
+
+    /**
+     * @brief Empties the table back to its first size.
+     */
+    void StringInterner::Clear()
+    {
+        _slots.assign(InitialSlots, NameView(nullptr, 0));
+        _count = 0;
+    }
+}
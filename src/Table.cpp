@@ -0,0 +1,67 @@
+/**
+ * @file Table.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Table class implementation, one game table with its own Deck and players.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <stdexcept>
+#include <Seat.h>
+#include <Table.h>
+
+namespace chants
+{
+
+    /**
+     * @brief Construct an empty Table.
+     *
+     * @param seed Seed of the table's rounds.
+     */
+    Table::Table(uint64_t seed) : _seed(seed), _round(0), _deck(Deck::Seeded(seed, 0))
+    {
+    }
+
+    /**
+     * @brief Seats a new player after the existing ones.
+     *
+     * @param name Name of the player.
+     * @param threshold Threshold of the player.
+     */
+    void Table::Join(const string &name, int threshold)
+    {
+        _players.push_back(Player(name, threshold));
+    }
+
+    /**
+     * @brief Plays one round from the deck reshuffled in place, with the seat and winner rules of
+     *        PlayBlackJack and SortPlayers. Unlike PlayBlackJack an empty deck is reported with an
+     *        exception instead of ending the program.
+     *
+     * @return uint64_t Index of the round.
+     */
+    uint64_t Table::Play()
+    {
+        if (_players.empty())
+            throw runtime_error("The table has no players");
+
+        _deck.Reset(_seed, _round);
+        for (Player &player : _players)
+        {
+            PlaySeat(player, _deck);
+        }
+        MarkWinners(_players);
+        return _round++;
+    }
+
+    /**
+     * @brief Retrieves the players.
+     *
+     * @return vector<Player>& Players in seat order.
+     */
+    vector<Player> &Table::Players()
+    {
+        return _players;
+    }
+}
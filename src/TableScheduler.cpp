@@ -0,0 +1,273 @@
+/**
+ * @file TableScheduler.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief TableScheduler implementation, coroutine tables resumed from one ready queue.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <TableScheduler.h>
+
+#ifdef BLACKJACK_HAS_COROUTINES
+
+#include <stdexcept>
+#include <Seat.h>
+
+namespace chants
+{
+
+    /**
+     * @brief Construct the state of an empty table.
+     *
+     * @param tableIndex Index of the table.
+     * @param tableSeed Seed of the table's rounds.
+     */
+    TableScheduler::TableState::TableState(size_t tableIndex, uint64_t tableSeed)
+        : index(tableIndex), seed(tableSeed), played(0), queued(0),
+          deck(Deck::Seeded(tableSeed, 0)), waitingSeat(-1), decision(false),
+          ready(false), task{nullptr}
+    {
+    }
+
+    /**
+     * @brief Construct an empty TableScheduler.
+     */
+    TableScheduler::TableScheduler() : _suspensions(0)
+    {
+    }
+
+    /**
+     * @brief Destroys every table's coroutine frame, suspended or finished.
+     */
+    TableScheduler::~TableScheduler()
+    {
+        for (unique_ptr<TableState> &table : _tables)
+        {
+            if (table->task.handle)
+                table->task.handle.destroy();
+        }
+    }
+
+    /**
+     * @brief Plays the table's queued rounds as Table::Play would. Each decision is awaited:
+     *        a bot's is ready, so the loop runs on without suspending, and a person's parks
+     *        the table until Decide. Seats are looked up by index after every await.
+     *
+     * @param table The table.
+     * @return TableTask The coroutine.
+     */
+    TableScheduler::TableTask TableScheduler::run(TableState &table)
+    {
+        for (;;)
+        {
+            co_await RoundsQueued{*this, table};
+            if (table.players.empty())
+                throw runtime_error("The table has no players");
+
+            table.deck.Reset(table.seed, table.played);
+            for (int seat = 0; seat < static_cast<int>(table.players.size()); seat++)
+            {
+                DealOpening(table.players[seat], table.deck);
+
+                // Awaited decisions take the place of PlaySeat's threshold draws
+                while (table.players[seat].Score() <= 21)
+                {
+                    bool hit = co_await SeatDecision{*this, table, seat, false};
+                    if (!hit)
+                        break;
+                    table.players[seat].AddCard(table.deck.Deal());
+                }
+                SettleSeat(table.players[seat]);
+            }
+            MarkWinners(table.players);
+            table.queued--;
+            table.played++;
+        }
+    }
+
+    /**
+     * @brief Queues a table to be resumed, once.
+     *
+     * @param table The table.
+     */
+    void TableScheduler::makeReady(TableState &table)
+    {
+        if (table.ready || table.task.handle.done())
+            return;
+        table.ready = true;
+        _ready.push_back(table.index);
+    }
+
+    /**
+     * @brief Retrieves a table.
+     *
+     * @param table Index of the table.
+     * @return TableState& The table.
+     */
+    TableScheduler::TableState &TableScheduler::state(size_t table) const
+    {
+        if (table >= _tables.size())
+            throw out_of_range("No such table");
+        return *_tables[table];
+    }
+
+    /**
+     * @brief Opens a table, its coroutine waits at the start until rounds are queued.
+     *
+     * @param seed Seed of the table's rounds.
+     * @return size_t Index of the table.
+     */
+    size_t TableScheduler::AddTable(uint64_t seed)
+    {
+        _tables.push_back(unique_ptr<TableState>(new TableState(_tables.size(), seed)));
+        TableState &table = *_tables.back();
+        table.task = run(table);
+        return table.index;
+    }
+
+    /**
+     * @brief Seats a bot after the existing players.
+     *
+     * @param table Index of the table.
+     * @param name Name of the player.
+     * @param threshold Threshold of the player.
+     */
+    void TableScheduler::JoinBot(size_t table, const string &name, int threshold)
+    {
+        TableState &seats = state(table);
+        if (seats.waitingSeat >= 0)
+            throw runtime_error("Seats can only change between rounds");
+        seats.players.push_back(Player(name, threshold));
+        seats.interactive.push_back(false);
+    }
+
+    /**
+     * @brief Seats a person after the existing players. The threshold is never used.
+     *
+     * @param table Index of the table.
+     * @param name Name of the player.
+     */
+    void TableScheduler::JoinInteractive(size_t table, const string &name)
+    {
+        TableState &seats = state(table);
+        if (seats.waitingSeat >= 0)
+            throw runtime_error("Seats can only change between rounds");
+        seats.players.push_back(Player(name, 21));
+        seats.interactive.push_back(true);
+    }
+
+    /**
+     * @brief Adds rounds to a table. A table in the middle of a round stays parked until its
+     *        decision comes, then goes on to the new rounds.
+     *
+     * @param table Index of the table.
+     * @param rounds Rounds to add.
+     */
+    void TableScheduler::QueueRounds(size_t table, uint64_t rounds)
+    {
+        TableState &queue = state(table);
+        queue.queued += rounds;
+        if (rounds > 0 && queue.waitingSeat < 0)
+            makeReady(queue);
+    }
+
+    /**
+     * @brief Resumes the ready tables in order. A table only comes back to the queue through
+     *        QueueRounds or Decide, so one pass leaves every table idle or waiting.
+     *
+     * @return size_t Number of resumes.
+     */
+    size_t TableScheduler::RunUntilIdle()
+    {
+        size_t resumes = 0;
+        for (size_t next = 0; next < _ready.size(); next++)
+        {
+            TableState &table = *_tables[_ready[next]];
+            table.ready = false;
+            table.task.handle.resume();
+            resumes++;
+
+            exception_ptr error = table.task.handle.promise().error;
+            if (error)
+            {
+                table.task.handle.promise().error = nullptr;
+                _ready.erase(_ready.begin(), _ready.begin() + next + 1);
+                rethrow_exception(error);
+            }
+        }
+        _ready.clear();
+        return resumes;
+    }
+
+    /**
+     * @brief Retrieves the seat a table waits on. A table already answered waits for nobody.
+     *
+     * @param table Index of the table.
+     * @return int Seat index, or -1.
+     */
+    int TableScheduler::WaitingSeat(size_t table) const
+    {
+        TableState &waiting = state(table);
+        return waiting.ready ? -1 : waiting.waitingSeat;
+    }
+
+    /**
+     * @brief Gives a table the decision it waits on and queues it.
+     *
+     * @param table Index of the table.
+     * @param hit True to take a card.
+     */
+    void TableScheduler::Decide(size_t table, bool hit)
+    {
+        TableState &waiting = state(table);
+        if (waiting.waitingSeat < 0 || waiting.ready)
+            throw runtime_error("The table is not waiting for a decision");
+        waiting.decision = hit;
+        makeReady(waiting);
+    }
+
+    /**
+     * @brief Retrieves the number of rounds played.
+     *
+     * @param table Index of the table.
+     * @return uint64_t Rounds played.
+     */
+    uint64_t TableScheduler::RoundsPlayed(size_t table) const
+    {
+        return state(table).played;
+    }
+
+    /**
+     * @brief Retrieves the players of a table.
+     *
+     * @param table Index of the table.
+     * @return vector<Player>& Players in seat order.
+     */
+    vector<Player> &TableScheduler::Players(size_t table)
+    {
+        return state(table).players;
+    }
+
+    /**
+     * @brief Retrieves the number of tables.
+     *
+     * @return size_t Number of tables.
+     */
+    size_t TableScheduler::Tables() const
+    {
+        return _tables.size();
+    }
+
+    /**
+     * @brief Retrieves the number of suspensions.
+     *
+     * @return uint64_t Suspensions.
+     */
+    uint64_t TableScheduler::Suspensions() const
+    {
+        return _suspensions;
+    }
+}
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file ThresholdModel.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief ThresholdModel implementation, the Markov chain of a threshold player's hand under the infinite deck model.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <stdexcept>
+#include <CardCode.h>
+#include <ThresholdModel.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Card points 2 - 11 and their probability with replacement, tens include Jack, Queen and King
+        const int Points[10] = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        const double Chance[10] = {1 / 13.0, 1 / 13.0, 1 / 13.0, 1 / 13.0, 1 / 13.0,
+                                   1 / 13.0, 1 / 13.0, 1 / 13.0, 4 / 13.0, 1 / 13.0};
+
+        /// @brief Aces tracked in a hand state, two or more Aces always score as 1 each
+        const int MaxAces = 2;
+
+        // Add a card to a (hard, aces) state, hard being the points with every Ace as 1.
+        // Two Aces already make 22 counted as 11, so capping the count changes no score.
+        void addCard(int &hard, int &aces, int points)
+        {
+            if (points == 11)
+            {
+                hard += 1;
+                if (aces < MaxAces)
+                    aces++;
+            }
+            else
+                hard += points;
+        }
+
+        // Score a (hard, aces) state the way Player does
+        int stateScore(int hard, int aces)
+        {
+            return HandScore(hard + 10 * aces, aces);
+        }
+    }
+
+    /**
+     * @brief Pushes the probability mass of every open hand through one more card at a time.
+     *        The first two cards are always dealt; after that every hand with a score below
+     *        the threshold draws and every other hand is finished. Hands are scored as Player
+     *        scores them, so A+A is 2, not 12. A hand's score is never below its hard points,
+     *        the points with every Ace counted as 1, and each draw adds at least one hard
+     *        point, so every hand finishes within 21 steps.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @return vector<double> Probability of each final score.
+     */
+    vector<double> ThresholdModel::FinalScores(int threshold)
+    {
+        if (threshold < 1 || threshold > 21)
+            throw runtime_error("Threshold must be between 1 and 21");
+
+        vector<double> final(MaxScore + 1, 0.0);
+        // open[aces][hard], the probability of an unfinished hand in each state
+        double open[MaxAces + 1][MaxScore + 1] = {};
+
+        for (int a = 0; a < 10; a++)
+        {
+            for (int b = 0; b < 10; b++)
+            {
+                int hard = 0;
+                int aces = 0;
+                addCard(hard, aces, Points[a]);
+                addCard(hard, aces, Points[b]);
+                open[aces][hard] += Chance[a] * Chance[b];
+            }
+        }
+
+        bool drawing = true;
+        while (drawing)
+        {
+            drawing = false;
+            double next[MaxAces + 1][MaxScore + 1] = {};
+            for (int aces = 0; aces <= MaxAces; aces++)
+            {
+                for (int hard = 0; hard <= MaxScore; hard++)
+                {
+                    double mass = open[aces][hard];
+                    if (mass == 0)
+                        continue;
+                    int score = stateScore(hard, aces);
+                    if (score >= threshold)
+                    {
+                        final[score] += mass;
+                        continue;
+                    }
+
+                    drawing = true;
+                    for (int c = 0; c < 10; c++)
+                    {
+                        int newHard = hard;
+                        int newAces = aces;
+                        addCard(newHard, newAces, Points[c]);
+                        next[newAces][newHard] += mass * Chance[c];
+                    }
+                }
+            }
+
+            for (int aces = 0; aces <= MaxAces; aces++)
+            {
+                for (int hard = 0; hard <= MaxScore; hard++)
+                    open[aces][hard] = next[aces][hard];
+            }
+        }
+        return final;
+    }
+
+    /**
+     * @brief Sums the final scores over 21.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @return double Probability of busting.
+     */
+    double ThresholdModel::BustProbability(int threshold)
+    {
+        vector<double> final = FinalScores(threshold);
+        double bust = 0;
+        for (int score = 22; score <= MaxScore; score++)
+            bust += final[score];
+        return bust;
+    }
+
+    /**
+     * @brief A seat wins with score s when every other seat busted or finished at s or below.
+     *        Seats are independent under the model, so those probabilities multiply.
+     *
+     * @param thresholds Threshold of each seat.
+     * @return vector<double> Win probability of each seat.
+     */
+    vector<double> ThresholdModel::WinProbabilities(const vector<int> &thresholds)
+    {
+        const size_t seats = thresholds.size();
+        vector<vector<double>> finals(seats);
+        // notAbove[i][s], probability that seat i busts or finishes with s or less
+        vector<vector<double>> notAbove(seats, vector<double>(22, 0.0));
+
+        for (size_t i = 0; i < seats; i++)
+        {
+            finals[i] = FinalScores(thresholds[i]);
+            double bust = 0;
+            for (int score = 22; score <= MaxScore; score++)
+                bust += finals[i][score];
+            double running = bust;
+            for (int score = 0; score <= 21; score++)
+            {
+                running += finals[i][score];
+                notAbove[i][score] = running;
+            }
+        }
+
+        vector<double> wins(seats, 0.0);
+        for (size_t i = 0; i < seats; i++)
+        {
+            for (int score = 0; score <= 21; score++)
+            {
+                if (finals[i][score] == 0)
+                    continue;
+                double others = 1;
+                for (size_t j = 0; j < seats; j++)
+                {
+                    if (j != i)
+                        others *= notAbove[j][score];
+                }
+                wins[i] += finals[i][score] * others;
+            }
+        }
+        return wins;
+    }
+}
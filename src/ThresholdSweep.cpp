@@ -0,0 +1,268 @@
+/**
+ * @file ThresholdSweep.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief SweepThresholds and ThresholdStudy implementation, every threshold from one walk.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <stdexcept>
+#include <ThresholdSweep.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        // Bits low + 1 up to high
+        inline uint32_t thresholdBits(int low, int high)
+        {
+            return ((2u << high) - 1) & ~((2u << low) - 1);
+        }
+    }
+
+    /**
+     * @brief Walks the shoe, settling thresholds each time the score beats its best so far.
+     *
+     * @param shoe Card codes.
+     * @param shoeSize Number of codes.
+     * @param first Offset of the seat's first card.
+     * @param sweep Outcome of every threshold.
+     */
+    void SweepThresholds(const uint8_t *shoe, int shoeSize, int first, ThresholdSweep &sweep)
+    {
+        // Deck::Deal refuses to deal the last card, as in PlayRound
+        const int usable = shoeSize - 1;
+        sweep.busted = 0;
+        sweep.overDealt = 0;
+        sweep.score[0] = 0;
+        sweep.cards[0] = 0;
+
+        int next = first;
+        if (next + 2 > usable)
+        {
+            sweep.overDealt = thresholdBits(0, MaxThreshold);
+            return;
+        }
+        int points = 0;
+        int aces = 0;
+        AddToScore(points, aces, shoe[next++]);
+        int score = AddToScore(points, aces, shoe[next++]);
+
+        // Thresholds up to settled have stopped
+        int settled = 0;
+        for (;;)
+        {
+            if (score > settled)
+            {
+                int reached = min(score, MaxThreshold);
+                for (int threshold = settled + 1; threshold <= reached; threshold++)
+                {
+                    sweep.score[threshold] = static_cast<uint8_t>(score);
+                    sweep.cards[threshold] = static_cast<uint8_t>(next - first);
+                }
+                if (score > 21)
+                    sweep.busted |= thresholdBits(settled, reached);
+                settled = reached;
+            }
+            if (settled == MaxThreshold)
+                return;
+            if (next >= usable)
+            {
+                sweep.overDealt = thresholdBits(settled, MaxThreshold);
+                return;
+            }
+            score = AddToScore(points, aces, shoe[next++]);
+        }
+    }
+
+    const int ThresholdStudy::MaxScore;
+
+    /**
+     * @brief Construct an empty study.
+     *
+     * @param seats Number of seats.
+     */
+    ThresholdStudy::ThresholdStudy(int seats)
+        : _seats(seats), _rounds(MaxThreshold, 0), _overDealt(MaxThreshold, 0), _shoes(0), _sweepCount(0)
+    {
+        if (seats < 1)
+            throw runtime_error("A study needs at least one seat");
+        _wins.assign(MaxThreshold * seats, 0);
+        _busts.assign(MaxThreshold * seats, 0);
+        _scores.assign(MaxThreshold * seats * (MaxScore + 1), 0);
+        _results.resize(seats);
+    }
+
+    /**
+     * @brief Plays the shoe at every threshold, sweeping each offset a seat starts at the first
+     *        time a threshold needs it.
+     *
+     * @param shoe Card codes.
+     * @param shoeSize Number of codes.
+     */
+    void ThresholdStudy::AddShoe(const uint8_t *shoe, int shoeSize)
+    {
+        if (static_cast<int>(_sweeps.size()) < shoeSize)
+        {
+            _sweeps.resize(shoeSize);
+            _sweptFor.resize(shoeSize, 0);
+        }
+        const uint64_t stamp = ++_shoes;
+
+        for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+        {
+            const uint32_t bit = 1u << threshold;
+            int offset = 0;
+            bool finished = true;
+            for (int seat = 0; seat < _seats && finished; seat++)
+            {
+                if (offset >= shoeSize)
+                {
+                    finished = false;
+                    break;
+                }
+                if (_sweptFor[offset] != stamp)
+                {
+                    SweepThresholds(shoe, shoeSize, offset, _sweeps[offset]);
+                    _sweptFor[offset] = stamp;
+                    _sweepCount++;
+                }
+                const ThresholdSweep &sweep = _sweeps[offset];
+                finished = (sweep.overDealt & bit) == 0;
+
+                SeatResult &result = _results[seat];
+                result.first = offset;
+                result.cards = sweep.cards[threshold];
+                result.score = sweep.score[threshold];
+                result.isBusted = (sweep.busted & bit) != 0;
+                offset += result.cards;
+            }
+
+            if (!finished)
+            {
+                _overDealt[threshold - 1]++;
+                continue;
+            }
+            MarkWinners(_results.data(), _seats);
+            AddRound(threshold, _results.data());
+        }
+    }
+
+    /**
+     * @brief Counts the round.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @param results One result per seat.
+     */
+    void ThresholdStudy::AddRound(int threshold, const SeatResult *results)
+    {
+        const int row = (threshold - 1) * _seats;
+        _rounds[threshold - 1]++;
+        for (int seat = 0; seat < _seats; seat++)
+        {
+            _wins[row + seat] += results[seat].isWinner;
+            _busts[row + seat] += results[seat].isBusted;
+            _scores[(row + seat) * (MaxScore + 1) + min(results[seat].score, MaxScore)]++;
+        }
+    }
+
+    /**
+     * @brief Retrieves the rounds of a threshold.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @return uint64_t Rounds.
+     */
+    uint64_t ThresholdStudy::Rounds(int threshold) const
+    {
+        return _rounds.at(threshold - 1);
+    }
+
+    /**
+     * @brief Retrieves the wins of a seat.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @param seat The seat.
+     * @return uint64_t Wins.
+     */
+    uint64_t ThresholdStudy::Wins(int threshold, int seat) const
+    {
+        return _wins.at((threshold - 1) * _seats + seat);
+    }
+
+    /**
+     * @brief Retrieves the busts of a seat.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @param seat The seat.
+     * @return uint64_t Busts.
+     */
+    uint64_t ThresholdStudy::Busts(int threshold, int seat) const
+    {
+        return _busts.at((threshold - 1) * _seats + seat);
+    }
+
+    /**
+     * @brief Retrieves a score count of a seat.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @param seat The seat.
+     * @param score The score.
+     * @return uint64_t Count.
+     */
+    uint64_t ThresholdStudy::ScoreCount(int threshold, int seat, int score) const
+    {
+        return _scores.at(((threshold - 1) * _seats + seat) * (MaxScore + 1) + score);
+    }
+
+    /**
+     * @brief Averages the score histogram of a seat.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @param seat The seat.
+     * @return double Mean score, 0 without rounds.
+     */
+    double ThresholdStudy::MeanScore(int threshold, int seat) const
+    {
+        uint64_t rounds = Rounds(threshold);
+        if (rounds == 0)
+            return 0;
+        uint64_t total = 0;
+        for (int score = 0; score <= MaxScore; score++)
+            total += score * ScoreCount(threshold, seat, score);
+        return static_cast<double>(total) / rounds;
+    }
+
+    /**
+     * @brief Retrieves the rounds a threshold could not finish.
+     *
+     * @param threshold Threshold 1 - 21.
+     * @return uint64_t Rounds.
+     */
+    uint64_t ThresholdStudy::OverDealt(int threshold) const
+    {
+        return _overDealt.at(threshold - 1);
+    }
+
+    /**
+     * @brief Retrieves the number of shoes.
+     *
+     * @return uint64_t Shoes.
+     */
+    uint64_t ThresholdStudy::Shoes() const
+    {
+        return _shoes;
+    }
+
+    /**
+     * @brief Retrieves the number of sweeps.
+     *
+     * @return uint64_t Sweeps.
+     */
+    uint64_t ThresholdStudy::Sweeps() const
+    {
+        return _sweepCount;
+    }
+}
@@ -0,0 +1,294 @@
+/**
+ * @file Tournament.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Tournament implementation, elimination rounds of tables played on several threads.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <Deck.h>
+#include <Philox.h>
+#include <Seat.h>
+#include <Tournament.h>
+
+namespace chants
+{
+
+    namespace
+    {
+        /// @brief Tables a thread takes from the round at a time
+        const uint64_t TableBlock = 256;
+        /// @brief Pool bytes an entrant takes: the player, its hand of 11 cards and its name
+        const uint64_t EntrantBytes = 256;
+        /// @brief Smallest and largest pool block
+        const uint64_t MinPoolBlock = 1 << 16;
+        const uint64_t MaxPoolBlock = 1 << 24;
+
+        // Pool block big enough for every entrant, so a small tournament does not reserve
+        // 16 MB and a large one still needs only a few blocks
+        inline size_t poolBlockBytes(uint64_t entrants)
+        {
+            uint64_t bytes = entrants < MaxPoolBlock / EntrantBytes ? entrants * EntrantBytes : MaxPoolBlock;
+            return static_cast<size_t>(max(bytes, MinPoolBlock));
+        }
+
+        // Deck stream of one deal of a table: round, table and redeal each get their own bits
+        inline uint64_t deckStream(uint64_t round, uint64_t table, uint64_t redeal)
+        {
+            return (round << 48) | ((table & 0xFFFFFFFFu) << 16) | (redeal & 0xFFFFu);
+        }
+    }
+
+    const int Tournament::MaxSeatsPerTable;
+
+    /**
+     * @brief Construct a Tournament, making every entrant in one pool and seating them in order.
+     *
+     * @param config Setup of the tournament.
+     */
+    Tournament::Tournament(const TournamentConfig &config)
+        : _config(config), _pool(poolBlockBytes(config.entrants)), _finished(false)
+    {
+        if (config.entrants == 0 || config.entrants > UINT32_MAX)
+            throw runtime_error("A tournament needs between 1 and 2^32 - 1 entrants");
+        if (config.seatsPerTable < 2 || config.seatsPerTable > MaxSeatsPerTable)
+            throw runtime_error("Tables must have between 2 and " + to_string(MaxSeatsPerTable) + " seats");
+        if (config.thresholds.empty())
+            throw runtime_error("A tournament needs at least one threshold");
+
+        _pool.Reserve(config.entrants);
+        _survivors.reserve(config.entrants);
+        string name;
+        for (uint64_t i = 0; i < config.entrants; i++)
+        {
+            name = "Entrant";
+            name += to_string(i + 1);
+            _pool.Add(name, config.thresholds[i % config.thresholds.size()]);
+            _survivors.push_back(static_cast<uint32_t>(i));
+        }
+        _roundsWon.assign(config.entrants, 0);
+        _advances.assign(config.entrants, 0);
+    }
+
+    // Tables are played on several threads from one pool. A hand dealt from one deck never
+    // passes HandCards cards, so AddCard never takes memory from the shared arena.
+    static_assert(PooledPlayer::HandCards >= 11, "A one deck hand must fit in a pooled hand");
+
+    /**
+     * @brief Deals the table from a deck of its own stream, again with the next stream while
+     *        every seat busts, then marks the seats with the best score as going on.
+     *
+     * @param deck Deck reused by the thread.
+     * @param first First seat of the table.
+     * @param seats Seats at the table.
+     * @param table Index of the table.
+     * @return uint64_t Times dealt again.
+     */
+    uint64_t Tournament::playTable(Deck &deck, size_t first, int seats, uint64_t table)
+    {
+        const uint64_t round = _rounds.size();
+        uint64_t redeals = 0;
+        int highestScore = -1;
+        for (;;)
+        {
+            deck.Reset(_config.seed, deckStream(round, table, redeals));
+            highestScore = -1;
+            try
+            {
+                for (int seat = 0; seat < seats; seat++)
+                {
+                    PooledPlayer &player = _pool[_survivors[first + seat]];
+                    PlaySeat(player, deck);
+                    if (!player.isBusted && player.Score() > highestScore)
+                        highestScore = player.Score();
+                }
+            }
+            catch (runtime_error &)
+            {
+                highestScore = -1;
+            }
+            if (highestScore >= 0)
+                break;
+            redeals++;
+        }
+
+        for (int seat = 0; seat < seats; seat++)
+        {
+            PooledPlayer &player = _pool[_survivors[first + seat]];
+            player.isWinner = !player.isBusted && player.Score() == highestScore;
+            _advances[first + seat] = player.isWinner;
+        }
+        return redeals;
+    }
+
+    /**
+     * @brief Shuffles the survivors, splits them into balanced tables, plays the tables on the
+     *        worker threads and keeps the winners in seat order.
+     *
+     * @return bool False when already finished.
+     */
+    bool Tournament::PlayRound()
+    {
+        if (_finished)
+            return false;
+
+        auto start = chrono::steady_clock::now();
+        const uint64_t round = _rounds.size();
+        const uint64_t players = _survivors.size();
+
+        // Seat the survivors in a new order, so winners of one table meet new players
+        PhiloxStream seating(~_config.seed, round);
+        for (uint64_t i = players - 1; i > 0; i--)
+        {
+            uint64_t j = seating.Bounded(static_cast<uint32_t>(i + 1));
+            swap(_survivors[i], _survivors[j]);
+        }
+
+        const uint64_t tables = (players + _config.seatsPerTable - 1) / _config.seatsPerTable;
+        const uint64_t smallest = players / tables;
+        const uint64_t larger = players % tables;
+
+        int threads = _config.threads;
+        if (threads <= 0)
+            threads = max(1, static_cast<int>(thread::hardware_concurrency()));
+        threads = static_cast<int>(min<uint64_t>(threads, (tables + TableBlock - 1) / TableBlock));
+
+        atomic<uint64_t> next(0);
+        atomic<uint64_t> redeals(0);
+        auto work = [&]()
+        {
+            Deck deck = Deck::Seeded(_config.seed, 0);
+            uint64_t redealt = 0;
+            for (uint64_t block = next.fetch_add(TableBlock); block < tables; block = next.fetch_add(TableBlock))
+            {
+                for (uint64_t table = block; table < min(block + TableBlock, tables); table++)
+                {
+                    // The first `larger` tables take one more seat
+                    size_t first = table * smallest + min(table, larger);
+                    int seats = static_cast<int>(smallest + (table < larger ? 1 : 0));
+                    redealt += playTable(deck, first, seats, table);
+                }
+            }
+            redeals += redealt;
+        };
+
+        vector<thread> workers;
+        for (int i = 1; i < threads; i++)
+            workers.emplace_back(work);
+        work();
+        for (thread &worker : workers)
+            worker.join();
+
+        size_t kept = 0;
+        for (size_t seat = 0; seat < players; seat++)
+        {
+            if (_advances[seat])
+            {
+                _roundsWon[_survivors[seat]]++;
+                _survivors[kept++] = _survivors[seat];
+            }
+        }
+        _survivors.resize(kept);
+        _finished = tables == 1;
+
+        TournamentRound played;
+        played.players = players;
+        played.tables = tables;
+        played.redeals = redeals;
+        played.survivors = kept;
+        played.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        _rounds.push_back(played);
+        return true;
+    }
+
+    /**
+     * @brief Plays rounds until the final table.
+     */
+    void Tournament::Run()
+    {
+        while (PlayRound())
+        {
+        }
+    }
+
+    /**
+     * @brief Retrieves whether the final table has played.
+     *
+     * @return bool True when finished.
+     */
+    bool Tournament::Finished() const
+    {
+        return _finished;
+    }
+
+    /**
+     * @brief Retrieves the entrants still in.
+     *
+     * @return const vector<uint32_t>& Entrant indices.
+     */
+    const vector<uint32_t> &Tournament::Survivors() const
+    {
+        return _survivors;
+    }
+
+    /**
+     * @brief Retrieves the rounds played.
+     *
+     * @return const vector<TournamentRound>& The rounds.
+     */
+    const vector<TournamentRound> &Tournament::Rounds() const
+    {
+        return _rounds;
+    }
+
+    /**
+     * @brief Retrieves the number of entrants.
+     *
+     * @return size_t Entrants.
+     */
+    size_t Tournament::Entrants() const
+    {
+        return _pool.Size();
+    }
+
+    /**
+     * @brief Retrieves an entrant.
+     *
+     * @param index The entrant.
+     * @return PooledPlayer& The player.
+     */
+    PooledPlayer &Tournament::Entrant(size_t index)
+    {
+        if (index >= _pool.Size())
+            throw out_of_range("No such entrant");
+        return _pool[index];
+    }
+
+    /**
+     * @brief Retrieves the rounds an entrant won.
+     *
+     * @param index The entrant.
+     * @return uint32_t Rounds won.
+     */
+    uint32_t Tournament::RoundsWon(size_t index) const
+    {
+        return _roundsWon.at(index);
+    }
+
+    /**
+     * @brief Retrieves the bytes of the entrants' pool.
+     *
+     * @return size_t Bytes reserved.
+     */
+    size_t Tournament::BytesReserved() const
+    {
+        return _pool.BytesReserved();
+    }
+}
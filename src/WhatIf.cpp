@@ -0,0 +1,200 @@
+/**
+ * @file WhatIf.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief RoundRecord and WhatIfRound implementation, incremental re-evaluation of a played round.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <stdexcept>
+#include <Round.h>
+#include <WhatIf.h>
+
+namespace chants
+{
+
+    /**
+     * @brief Copies the card codes of every card left in the deck, top first.
+     *
+     * @param deck The deck of the round.
+     */
+    RoundRecord::RoundRecord(Deck &deck)
+    {
+        int count = deck.CardsInDeck();
+        order.reserve(count);
+        for (int i = 0; i < count; i++)
+        {
+            Card card = deck.CardAt(i);
+            order.push_back(MakeCardCode(card.GetRank(), card.GetSuit()));
+        }
+    }
+
+    /**
+     * @brief Appends a seat.
+     *
+     * @param threshold Threshold of the seat.
+     * @param first Offset of its first card.
+     * @param cards Cards dealt to it.
+     * @param score Its final score.
+     */
+    void RoundRecord::AddSeat(int threshold, int first, int cards, int score)
+    {
+        seats.push_back(RecordedSeat{threshold, first, cards, score});
+    }
+
+    /**
+     * @brief Construct a WhatIfRound, counting the recorded scores.
+     *
+     * @param record The recorded round.
+     */
+    WhatIfRound::WhatIfRound(const RoundRecord &record)
+        : _order(record.order), _seats(record.seats), _scoreCounts(), _bestScore(0)
+    {
+        if (_seats.empty())
+            throw runtime_error("The record has no seats");
+        for (const RecordedSeat &seat : _seats)
+        {
+            if (seat.score <= 21)
+                _scoreCounts[seat.score]++;
+        }
+        refreshBestScore();
+        _pending.reserve(_seats.size());
+    }
+
+    /**
+     * @brief Deals two cards and then draws below the threshold, refusing the last card of the
+     *        deck as Deck::Deal does.
+     *
+     * @param seat Seat with threshold and first set.
+     * @return bool False if the deck ran out.
+     */
+    bool WhatIfRound::deal(RecordedSeat &seat) const
+    {
+        const int usable = static_cast<int>(_order.size()) - 1;
+        int next = seat.first;
+        int points = 0;
+        int aces = 0;
+        int score = 0;
+        do
+        {
+            if (next >= usable)
+                return false;
+            score = AddToScore(points, aces, _order[next++]);
+        } while (next - seat.first < 2 || score < seat.threshold);
+
+        seat.cards = next - seat.first;
+        seat.score = score;
+        return true;
+    }
+
+    /**
+     * @brief Finds the highest score any seat has without busting.
+     */
+    void WhatIfRound::refreshBestScore()
+    {
+        _bestScore = 0;
+        for (int score = 21; score > 0 && _bestScore == 0; score--)
+        {
+            if (_scoreCounts[score] > 0)
+                _bestScore = score;
+        }
+    }
+
+    /**
+     * @brief Re-deals the seat and the seats after it until one starts where it did before,
+     *        then applies the new seats and updates the score histogram.
+     *
+     * @param seat The seat.
+     * @param threshold Its new threshold.
+     * @return int Seats re-evaluated, -1 if the deck ran out.
+     */
+    int WhatIfRound::SetThreshold(int seat, int threshold)
+    {
+        if (threshold < 1 || threshold > 21)
+            throw runtime_error("Threshold must be between 1 and 21");
+        if (_seats.at(seat).threshold == threshold)
+            return 0;
+
+        _pending.clear();
+        int first = _seats[seat].first;
+        for (int i = seat; i < static_cast<int>(_seats.size()); i++)
+        {
+            if (i > seat && first == _seats[i].first)
+                break;
+            RecordedSeat moved = _seats[i];
+            moved.first = first;
+            if (i == seat)
+                moved.threshold = threshold;
+            if (!deal(moved))
+                return -1;
+            _pending.push_back(moved);
+            first += moved.cards;
+        }
+
+        for (size_t i = 0; i < _pending.size(); i++)
+        {
+            RecordedSeat &current = _seats[seat + i];
+            if (current.score <= 21)
+                _scoreCounts[current.score]--;
+            current = _pending[i];
+            if (current.score <= 21)
+                _scoreCounts[current.score]++;
+        }
+        refreshBestScore();
+        return static_cast<int>(_pending.size());
+    }
+
+    /**
+     * @brief Retrieves the number of seats.
+     *
+     * @return int Seats.
+     */
+    int WhatIfRound::Seats() const
+    {
+        return static_cast<int>(_seats.size());
+    }
+
+    /**
+     * @brief Retrieves a seat.
+     *
+     * @param seat The seat.
+     * @return const RecordedSeat& Its threshold, cut point, cards and score.
+     */
+    const RecordedSeat &WhatIfRound::Seat(int seat) const
+    {
+        return _seats.at(seat);
+    }
+
+    /**
+     * @brief Checks a seat's score against 21.
+     *
+     * @param seat The seat.
+     * @return bool True when busted.
+     */
+    bool WhatIfRound::IsBusted(int seat) const
+    {
+        return _seats.at(seat).score > 21;
+    }
+
+    /**
+     * @brief Compares a seat's score with the best score.
+     *
+     * @param seat The seat.
+     * @return bool True when it wins.
+     */
+    bool WhatIfRound::IsWinner(int seat) const
+    {
+        return !IsBusted(seat) && _seats[seat].score == _bestScore;
+    }
+
+    /**
+     * @brief Retrieves the winning score.
+     *
+     * @return int The score, 0 when nobody wins.
+     */
+    int WhatIfRound::BestScore() const
+    {
+        return _bestScore;
+    }
+}
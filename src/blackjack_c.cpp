@@ -0,0 +1,183 @@
+/**
+ * @file blackjack_c.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief C interface implementation. Every call catches its own exceptions, since none may
+ *        cross into the caller's language.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <blackjack_c.h>
+#include <Round.h>
+#include <ShuffleKernel.h>
+
+using namespace chants;
+
+/**
+ * @brief Engine state behind the opaque handle, sized once at creation so playing never allocates
+ */
+struct bj_engine
+{
+    /// @brief Seed of the run
+    uint64_t seed;
+    /// @brief Decks per shoe
+    int decks;
+    /// @brief Threshold of each seat
+    std::vector<int> thresholds;
+    /// @brief Shoe of the round being played
+    std::vector<uint8_t> shoe;
+    /// @brief Outcome of each seat in the round being played
+    std::vector<SeatResult> results;
+};
+
+namespace
+{
+    /// @brief Most decks a shoe may have
+    const int MaxDecks = 8;
+
+    // Shuffle and play one round into the engine's results, false if the shoe ran out
+    bool playOne(bj_engine *engine, uint64_t round)
+    {
+        const int seats = static_cast<int>(engine->thresholds.size());
+        ShuffleKernel::ShuffleRound(engine->seed, round, engine->shoe.data(), engine->decks);
+        return PlayRound(engine->shoe.data(), static_cast<int>(engine->shoe.size()),
+                         engine->thresholds.data(), seats, engine->results.data()) >= 0;
+    }
+}
+
+int bj_api_version(void)
+{
+    return BJ_API_VERSION;
+}
+
+const char *bj_status_string(int status)
+{
+    switch (status)
+    {
+    case BJ_OK:
+        return "ok";
+    case BJ_ERROR_ARGUMENT:
+        return "invalid argument";
+    case BJ_ERROR_OVER_DEALT:
+        return "shoe ran out of cards";
+    case BJ_ERROR_MEMORY:
+        return "out of memory";
+    case BJ_ERROR_INTERNAL:
+        return "internal error";
+    default:
+        return "unknown status";
+    }
+}
+
+int bj_engine_create(uint64_t seed, int seats, const int *thresholds, int decks, bj_engine **engine)
+{
+    if (engine == nullptr)
+        return BJ_ERROR_ARGUMENT;
+    *engine = nullptr;
+    if (seats < 1 || thresholds == nullptr || decks < 1 || decks > MaxDecks)
+        return BJ_ERROR_ARGUMENT;
+    for (int i = 0; i < seats; i++)
+    {
+        if (thresholds[i] < 1 || thresholds[i] > 21)
+            return BJ_ERROR_ARGUMENT;
+    }
+
+    try
+    {
+        bj_engine *created = new bj_engine;
+        created->seed = seed;
+        created->decks = decks;
+        created->thresholds.assign(thresholds, thresholds + seats);
+        created->shoe.resize(decks * CardsPerDeck);
+        created->results.resize(seats);
+        *engine = created;
+        return BJ_OK;
+    }
+    catch (const std::bad_alloc &)
+    {
+        return BJ_ERROR_MEMORY;
+    }
+    catch (...)
+    {
+        return BJ_ERROR_INTERNAL;
+    }
+}
+
+void bj_engine_destroy(bj_engine *engine)
+{
+    delete engine;
+}
+
+int bj_engine_seats(const bj_engine *engine)
+{
+    if (engine == nullptr)
+        return BJ_ERROR_ARGUMENT;
+    return static_cast<int>(engine->thresholds.size());
+}
+
+int bj_play_rounds(bj_engine *engine, uint64_t first_round, uint64_t rounds,
+                   int32_t *scores, uint8_t *winners, uint8_t *busted)
+{
+    if (engine == nullptr)
+        return BJ_ERROR_ARGUMENT;
+
+    try
+    {
+        const size_t seats = engine->thresholds.size();
+        for (uint64_t r = 0; r < rounds; r++)
+        {
+            if (!playOne(engine, first_round + r))
+                return BJ_ERROR_OVER_DEALT;
+
+            const size_t base = r * seats;
+            for (size_t i = 0; i < seats; i++)
+            {
+                const SeatResult &result = engine->results[i];
+                if (scores != nullptr)
+                    scores[base + i] = result.score;
+                if (winners != nullptr)
+                    winners[base + i] = result.isWinner ? 1 : 0;
+                if (busted != nullptr)
+                    busted[base + i] = result.isBusted ? 1 : 0;
+            }
+        }
+        return BJ_OK;
+    }
+    catch (...)
+    {
+        return BJ_ERROR_INTERNAL;
+    }
+}
+
+int bj_count_rounds(bj_engine *engine, uint64_t first_round, uint64_t rounds,
+                    uint64_t *wins, uint64_t *busts)
+{
+    if (engine == nullptr || wins == nullptr)
+        return BJ_ERROR_ARGUMENT;
+
+    try
+    {
+        const size_t seats = engine->thresholds.size();
+        for (uint64_t r = 0; r < rounds; r++)
+        {
+            if (!playOne(engine, first_round + r))
+                return BJ_ERROR_OVER_DEALT;
+
+            for (size_t i = 0; i < seats; i++)
+            {
+                wins[i] += engine->results[i].isWinner;
+                if (busts != nullptr)
+                    busts[i] += engine->results[i].isBusted;
+            }
+        }
+        return BJ_OK;
+    }
+    catch (...)
+    {
+        return BJ_ERROR_INTERNAL;
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * @file AllocationHooks.cpp
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Replacements of every global operator new and delete that count the heap activity
+ *        reported by AllocationHooks.h. Link this file into an executable once.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#include "AllocationHooks.h"
+
+namespace chants
+{
+
+    namespace
+    {
+        std::atomic<uint64_t> allocationCalls(0);
+        std::atomic<uint64_t> freeCalls(0);
+        std::atomic<uint64_t> allocatedBytes(0);
+
+        // Count an allocation and get its memory from malloc, nullptr if there is none.
+        // Every operator new goes through here and every operator delete through release, so
+        // the malloc and free pair is never seen next to a new expression.
+        void *acquire(std::size_t size)
+        {
+            allocationCalls.fetch_add(1, std::memory_order_relaxed);
+            allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            return std::malloc(size == 0 ? 1 : size);
+        }
+
+        void release(void *memory)
+        {
+            if (memory == nullptr)
+                return;
+            freeCalls.fetch_add(1, std::memory_order_relaxed);
+            std::free(memory);
+        }
+
+#if defined(__cpp_aligned_new)
+        // As acquire, for types aligned past what malloc guarantees
+        void *acquireAligned(std::size_t size, std::size_t alignment)
+        {
+            allocationCalls.fetch_add(1, std::memory_order_relaxed);
+            allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            // aligned_alloc needs a size that is a multiple of the alignment
+            std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+#if defined(_WIN32)
+            return _aligned_malloc(rounded == 0 ? alignment : rounded, alignment);
+#else
+            return aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+#endif
+        }
+
+        void releaseAligned(void *memory)
+        {
+            if (memory == nullptr)
+                return;
+            freeCalls.fetch_add(1, std::memory_order_relaxed);
+#if defined(_WIN32)
+            _aligned_free(memory);
+#else
+            std::free(memory);
+#endif
+        }
+#endif
+    }
+
+    /**
+     * @brief Read the counters, each on its own, so a count taken while other threads allocate
+     *        is only approximate
+     *
+     * @return AllocationCount
+     */
+    AllocationCount CurrentAllocations()
+    {
+        return {allocationCalls.load(std::memory_order_relaxed),
+                freeCalls.load(std::memory_order_relaxed),
+                allocatedBytes.load(std::memory_order_relaxed)};
+    }
+}
+
+void *operator new(std::size_t size)
+{
+    void *memory = chants::acquire(size);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return chants::acquire(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return chants::acquire(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    chants::release(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    chants::release(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    chants::release(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+    chants::release(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+    chants::release(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+    chants::release(memory);
+}
+
+#if defined(__cpp_aligned_new)
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    void *memory = chants::acquireAligned(size, static_cast<std::size_t>(alignment));
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return chants::acquireAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return chants::acquireAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept
+{
+    chants::releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept
+{
+    chants::releaseAligned(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept
+{
+    chants::releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept
+{
+    chants::releaseAligned(memory);
+}
+
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    chants::releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    chants::releaseAligned(memory);
+}
+#endif
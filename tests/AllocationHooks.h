@@ -0,0 +1,69 @@
+/**
+ * @file AllocationHooks.h
+ * @author Evan Aarons-Wood (evanaaronswood@gmail.com)
+ * @brief Counts every heap allocation made through the global operator new and delete, so tests
+ *        and benches can check how many allocations and bytes a piece of code costs. The
+ *        replacement operators are defined in AllocationHooks.cpp, which an executable using
+ *        this header links in once; never link it into the library.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chants
+{
+
+    /**
+     * @brief Heap activity counted over a stretch of code
+     */
+    struct AllocationCount
+    {
+        /// @brief Calls to any operator new
+        uint64_t allocations;
+        /// @brief Calls to any operator delete with a non null pointer
+        uint64_t frees;
+        /// @brief Bytes asked for by the allocations
+        uint64_t bytes;
+    };
+
+    /**
+     * @brief Get the heap activity since the program started, from every thread
+     *
+     * @return AllocationCount
+     */
+    AllocationCount CurrentAllocations();
+
+    /**
+     * @brief AllocationScope counts the heap activity from its construction to each Count call
+     */
+    class AllocationScope
+    {
+    private:
+        /// @brief Activity when the scope started
+        AllocationCount _start;
+
+    public:
+        /**
+         * @brief Start counting
+         *
+         */
+        AllocationScope() : _start(CurrentAllocations())
+        {
+        }
+
+        /**
+         * @brief Get the heap activity since the scope started
+         *
+         * @return AllocationCount
+         */
+        AllocationCount Count() const
+        {
+            AllocationCount now = CurrentAllocations();
+            return {now.allocations - _start.allocations, now.frees - _start.frees, now.bytes - _start.bytes};
+        }
+    };
+}
@@ -8,10 +8,49 @@
  *
  */
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
 #include <vector>
 #include <Card.h>
 #include <Deck.h>
 #include <Player.h>
+#include <ShuffleKernel.h>
+#include <BoundedQueue.h>
+#include <Pipeline.h>
+#include <Round.h>
+#include <Philox.h>
+#include <HandHistory.h>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <GameServer.h>
+#include <Table.h>
+#include <InfiniteDeck.h>
+#include <ThresholdModel.h>
+#include <utils.h>
+#include <Statistics.h>
+#include <StrategySolver.h>
+#include <BasicStrategy.h>
+#include <MultiCounter.h>
+#include "AllocationHooks.h"
+#include <blackjack_c.h>
+#include <PlayerPool.h>
+#include <TableScheduler.h>
+#include <DealerTable.h>
+#include <BankrollSimulator.h>
+#include <RuinCalculator.h>
+#include <ThresholdSweep.h>
+#include <WhatIf.h>
+#include <Tournament.h>
 
 using namespace chants;
 
@@ -208,4 +247,1898 @@ TEST(PlayerTest, PlayerInValidScore)
     int val = player.Score();
 
     EXPECT_EQ(val, 22);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Every shoe in a batch must hold each card code exactly once per deck,
+ *      including the shoes of a partial last group of lanes.
+ */
+TEST(ShuffleKernelTest, BatchIsPermutation)
+{
+    const int shoes = ShuffleKernel::Lanes + 3;
+    const int decks = 2;
+    std::vector<uint8_t> buffer(shoes * CardsPerDeck * decks);
+    ShuffleKernel kernel(42);
+    kernel.ShuffleBatch(buffer.data(), shoes, decks);
+
+    for (int k = 0; k < shoes; k++)
+    {
+        int counts[CardsPerDeck] = {0};
+        for (int i = 0; i < CardsPerDeck * decks; i++)
+        {
+            counts[buffer[k * CardsPerDeck * decks + i]]++;
+        }
+        for (int code = 0; code < CardsPerDeck; code++)
+        {
+            EXPECT_EQ(counts[code], decks);
+        }
+    }
+}
+
+/**
+ * @brief The same seed must give the same batch, and the lanes must not repeat each other.
+ */
+TEST(ShuffleKernelTest, SameSeedSameBatch)
+{
+    std::vector<uint8_t> first(ShuffleKernel::Lanes * CardsPerDeck);
+    std::vector<uint8_t> second(ShuffleKernel::Lanes * CardsPerDeck);
+    ShuffleKernel a(7);
+    ShuffleKernel b(7);
+    a.ShuffleBatch(first.data(), ShuffleKernel::Lanes, 1);
+    b.ShuffleBatch(second.data(), ShuffleKernel::Lanes, 1);
+
+    EXPECT_EQ(first, second);
+    EXPECT_FALSE(std::equal(first.begin(), first.begin() + CardsPerDeck, first.begin() + CardsPerDeck));
+}
+
+/**
+ * @brief A Deck built from a shoe deals the codes in order.
+ */
+TEST(ShuffleKernelTest, DeckFromShoeDealsInOrder)
+{
+    uint8_t shoe[CardsPerDeck];
+    ShuffleKernel kernel(3);
+    kernel.ShuffleBatch(shoe, 1, 1);
+
+    Deck deck = Deck::FromCodes(shoe, CardsPerDeck);
+    EXPECT_EQ(deck.CardsInDeck(), CardsPerDeck);
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(deck.Deal().GetValue(), CodeToPoints(shoe[i]));
+    }
+}
+
+/**
+ * @brief PlayRound on an unshuffled deck must give the same scores as Players dealt from Deck(false).
+ */
+TEST(RoundTest, PlayRoundMatchesPlayers)
+{
+    uint8_t shoe[CardsPerDeck];
+    ShuffleKernel::FillOrdered(shoe, 1);
+    int thresholds[3] = {17, 12, 21};
+    SeatResult results[3];
+    int dealt = PlayRound(shoe, CardsPerDeck, thresholds, 3, results);
+
+    Deck deck(false);
+    int cards = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        Player player("Seat", thresholds[i]);
+        player.AddCard(deck.Deal());
+        player.AddCard(deck.Deal());
+        while (player.Score() < player.GetThreshold())
+            player.AddCard(deck.Deal());
+
+        EXPECT_EQ(results[i].score, player.Score());
+        EXPECT_EQ(results[i].cards, player.CountCards());
+        EXPECT_EQ(results[i].first, cards);
+        cards += player.CountCards();
+    }
+    EXPECT_EQ(dealt, cards);
+}
+
+/**
+ * @brief PlayRound scores and marks winners like PlayBlackJack and SortPlayers on seeded
+ *        shuffles, including hands with several Aces such as A, A, 9, which Player scores 11.
+ */
+TEST(RoundTest, PlayRoundMatchesPlayBlackJackWithAces)
+{
+    const int seats = 4;
+    int thresholds[seats] = {17, 17, 17, 17};
+    SeatResult results[seats];
+    ShuffleKernel kernel(19);
+    vector<uint8_t> shoes(ShuffleKernel::Lanes * CardsPerDeck);
+    int multiAceHands = 0;
+    for (int round = 0; round < 5000; round++)
+    {
+        if (round % ShuffleKernel::Lanes == 0)
+            kernel.ShuffleBatch(shoes.data(), ShuffleKernel::Lanes, 1);
+        const uint8_t *shoe = &shoes[(round % ShuffleKernel::Lanes) * CardsPerDeck];
+        ASSERT_GE(PlayRound(shoe, CardsPerDeck, thresholds, seats, results), 0);
+
+        vector<Player> players;
+        for (int i = 0; i < seats; i++)
+            players.push_back(Player(to_string(i), thresholds[i]));
+        Deck deck = Deck::FromCodes(shoe, CardsPerDeck);
+        PlayBlackJack(players, deck);
+        for (int i = 0; i < seats; i++)
+        {
+            int aces = 0;
+            for (int card = 0; card < results[i].cards; card++)
+                aces += CodeToValue(shoe[results[i].first + card]) == 1;
+            multiAceHands += aces >= 2;
+            ASSERT_EQ(results[i].score, players[i].Score()) << "round " << round << " seat " << i;
+            ASSERT_EQ(results[i].isBusted, players[i].isBusted);
+        }
+
+        SortPlayers(players);
+        for (Player &player : players)
+            EXPECT_EQ(results[stoi(player.GetName())].isWinner, player.isWinner);
+    }
+    EXPECT_GT(multiAceHands, 100);
+}
+
+/**
+ * @brief Ties share the win and busted seats never win.
+ */
+TEST(RoundTest, MarkWinnersTies)
+{
+    SeatResult results[4] = {{0, 2, 20, false, false}, {2, 3, 25, true, false}, {5, 2, 20, false, false}, {7, 2, 18, false, false}};
+    MarkWinners(results, 4);
+    EXPECT_TRUE(results[0].isWinner);
+    EXPECT_FALSE(results[1].isWinner);
+    EXPECT_TRUE(results[2].isWinner);
+    EXPECT_FALSE(results[3].isWinner);
+}
+
+/**
+ * @brief A full queue refuses pushes and items come out in order.
+ */
+TEST(BoundedQueueTest, FullAndEmpty)
+{
+    BoundedQueue<int> queue(4);
+    int item;
+    EXPECT_FALSE(queue.TryPop(item));
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(queue.TryPush(i));
+    EXPECT_FALSE(queue.TryPush(4));
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(queue.TryPop(item));
+        EXPECT_EQ(item, i);
+    }
+    EXPECT_FALSE(queue.TryPop(item));
+}
+
+/**
+ * @brief Every requested round is played once across several threads per stage.
+ */
+TEST(PipelineTest, PlaysEveryRound)
+{
+    PipelineConfig config;
+    config.rounds = 1001;
+    config.shufflerThreads = 2;
+    config.playerThreads = 2;
+    config.queueCapacity = 4;
+    config.thresholds = {17, 17, 15};
+    PipelineReport report = Pipeline(config).Run();
+
+    EXPECT_EQ(report.stats.Rounds() + report.overDealt, 1001u);
+    EXPECT_EQ(report.play.items, report.shuffle.items);
+    EXPECT_EQ(report.aggregate.items, report.shuffle.items);
+    EXPECT_FALSE(report.stoppedEarly);
+    double wins = 0;
+    for (int i = 0; i < 3; i++)
+        wins += report.stats.Wins(i).Mean();
+    EXPECT_GE(wins, 0.5);
+}
+
+/**
+ * @brief The per-thread rate divides by the busy time summed over the threads, so four threads each
+ *        busy for one second on 25 items report 25 items per second, in a run as well.
+ */
+TEST(PipelineTest, ThroughputIsPerThread)
+{
+    StageStats stage;
+    stage.threads = 4;
+    stage.items = 100;
+    stage.busyNanos = 4000000000ull;
+    EXPECT_DOUBLE_EQ(stage.ThroughputPerThread(), 25.0);
+    EXPECT_EQ(StageStats().ThroughputPerThread(), 0.0);
+
+    PipelineConfig config;
+    config.rounds = 2000;
+    config.shufflerThreads = 3;
+    config.playerThreads = 2;
+    config.thresholds = {16, 17};
+    PipelineReport report = Pipeline(config).Run();
+    EXPECT_EQ(report.shuffle.threads, 3);
+    ASSERT_GT(report.shuffle.busyNanos, 0u);
+    EXPECT_DOUBLE_EQ(report.shuffle.ThroughputPerThread(), report.shuffle.items * 1e9 / report.shuffle.busyNanos);
+    EXPECT_DOUBLE_EQ(report.play.ThroughputPerThread(), report.play.items * 1e9 / report.play.busyNanos);
+}
+
+/**
+ * @brief Batches are merged in round order, so win streaks match one thread playing every round
+ *        in order, however the player threads finish.
+ */
+TEST(PipelineTest, StreaksFollowRoundOrder)
+{
+    PipelineConfig config;
+    config.rounds = 4000;
+    config.seed = 8;
+    config.shufflerThreads = 2;
+    config.playerThreads = 3;
+    config.queueCapacity = 6;
+    config.shoesPerSlot = 3;
+    config.thresholds = {19, 14, 16};
+
+    SimulationStats expected(3);
+    SeatResult results[3];
+    uint8_t shoe[CardsPerDeck];
+    for (uint64_t round = 0; round < config.rounds; round++)
+    {
+        ShuffleKernel::ShuffleRound(config.seed, round, shoe, 1);
+        if (PlayRound(shoe, CardsPerDeck, config.thresholds.data(), 3, results) >= 0)
+            expected.AddRound(results, config.thresholds.data());
+    }
+
+    for (int run = 0; run < 3; run++)
+    {
+        PipelineReport report = Pipeline(config).Run();
+        for (int i = 0; i < 3; i++)
+            EXPECT_EQ(report.stats.LongestWinStreak(i), expected.LongestWinStreak(i));
+    }
+}
+
+/**
+ * @brief Replaying a pipeline round the way `blackjack round` does, from Deck::Seeded(seed, round), gives
+ *        the scores and winners the pipeline counted, also for rounds with an A, A hand.
+ */
+TEST(PhiloxTest, ReplayMatchesPipelineWithAces)
+{
+    const uint64_t seed = 4242;
+    const int seats = 4;
+    int thresholds[seats] = {17, 17, 17, 17};
+    SeatResult results[seats];
+    uint8_t shoe[CardsPerDeck];
+    int pairsOfAces = 0;
+    for (uint64_t round = 0; round < 3000; round++)
+    {
+        ShuffleKernel::ShuffleRound(seed, round, shoe, 1);
+        if (PlayRound(shoe, CardsPerDeck, thresholds, seats, results) < 0)
+            continue;
+        bool hasPair = false;
+        for (int i = 0; i < seats; i++)
+            hasPair |= CodeToValue(shoe[results[i].first]) == 1 && CodeToValue(shoe[results[i].first + 1]) == 1;
+        if (!hasPair)
+            continue;
+        pairsOfAces++;
+
+        vector<Player> players;
+        for (int i = 0; i < seats; i++)
+            players.push_back(Player(to_string(i), thresholds[i]));
+        Deck deck = Deck::Seeded(seed, round);
+        PlayBlackJack(players, deck);
+        SortPlayers(players);
+        for (Player &player : players)
+        {
+            const SeatResult &result = results[stoi(player.GetName())];
+            EXPECT_EQ(result.score, player.Score());
+            EXPECT_EQ(result.isWinner, player.isWinner);
+        }
+    }
+    EXPECT_GT(pairsOfAces, 10);
+}
+
+/**
+ * @brief Merging two halves must give the same mean and variance as one stream.
+ */
+TEST(StatisticsTest, RunningStatsMerge)
+{
+    RunningStats all;
+    RunningStats left;
+    RunningStats right;
+    for (int i = 0; i < 100; i++)
+    {
+        double value = (i * 37) % 11;
+        all.Add(value);
+        if (i < 40)
+            left.Add(value);
+        else
+            right.Add(value);
+    }
+    left.Merge(right);
+    EXPECT_EQ(left.Count(), all.Count());
+    EXPECT_NEAR(left.Mean(), all.Mean(), 1e-12);
+    EXPECT_NEAR(left.Variance(), all.Variance(), 1e-9);
+}
+
+/**
+ * @brief A win streak that crosses the end of one batch continues into the next when merged.
+ */
+TEST(StatisticsTest, StreaksJoinAcrossMerge)
+{
+    int thresholds[1] = {17};
+    SeatResult win = {0, 2, 20, false, true};
+    SeatResult bust = {0, 3, 24, true, false};
+    SimulationStats first(1);
+    SimulationStats second(1);
+    first.AddRound(&win, thresholds);
+    first.AddRound(&bust, thresholds);
+    first.AddRound(&win, thresholds);
+    first.AddRound(&win, thresholds);
+    second.AddRound(&win, thresholds);
+    second.AddRound(&bust, thresholds);
+
+    first.Merge(second);
+    EXPECT_EQ(first.Rounds(), 6u);
+    EXPECT_EQ(first.LongestWinStreak(0), 3u);
+    EXPECT_EQ(first.Busts(0), 2u);
+    EXPECT_EQ(first.ScoreCount(0, 20), 4u);
+    EXPECT_DOUBLE_EQ(first.BustRateAtThreshold(17), 2.0 / 6.0);
+}
+
+/**
+ * @brief With a loose precision the pipeline stops long before the requested rounds.
+ */
+TEST(PipelineTest, EarlyStop)
+{
+    PipelineConfig config;
+    config.rounds = 100000000;
+    config.queueCapacity = 4;
+    config.thresholds = {17, 15};
+    config.earlyStop.halfWidth = 0.02;
+    PipelineReport report = Pipeline(config).Run();
+
+    EXPECT_TRUE(report.stoppedEarly);
+    EXPECT_LT(report.stats.Rounds(), 100000u);
+    EXPECT_LE(report.stats.Wins(0).HalfWidth(1.96), 0.02);
+}
+
+/**
+ * @brief Philox4x32-10 known answer from the Random123 test vectors, zero key and counter.
+ */
+TEST(PhiloxTest, KnownAnswer)
+{
+    uint32_t counter[4] = {0, 0, 0, 0};
+    Philox4x32(counter, 0, 0);
+    EXPECT_EQ(counter[0], 0x6627e8d5u);
+    EXPECT_EQ(counter[1], 0xe169c58du);
+    EXPECT_EQ(counter[2], 0xbc57ac4cu);
+    EXPECT_EQ(counter[3], 0x9b00dbd8u);
+}
+
+/**
+ * @brief A round regenerated on its own deals the same cards, and other rounds differ.
+ */
+TEST(PhiloxTest, RoundIsReproducible)
+{
+    Deck first = Deck::Seeded(12345u, 1000000u);
+    Deck again = Deck::Seeded(12345u, 1000000u);
+    Deck other = Deck::Seeded(12345u, 1000001u);
+    uint8_t shoe[CardsPerDeck];
+    ShuffleKernel::ShuffleRound(12345u, 1000000u, shoe, 1);
+
+    int same = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        int value = first.Deal().GetValue();
+        EXPECT_EQ(value, again.Deal().GetValue());
+        EXPECT_EQ(value, CodeToPoints(shoe[i]));
+        same += value == other.Deal().GetValue();
+    }
+    EXPECT_LT(same, 20);
+}
+
+/**
+ * @brief The batched kernel shuffles every shoe like ShuffleRound, including a partial batch and 6-deck shoes.
+ */
+TEST(PhiloxTest, BatchedRoundsMatchShuffleRound)
+{
+    const int decks[] = {1, 2, 6};
+    const int shoes = 2 * ShuffleKernel::Lanes + 3;
+    for (int d : decks)
+    {
+        const int shoeSize = CardsPerDeck * d;
+        vector<uint8_t> batch(static_cast<size_t>(shoes) * shoeSize);
+        vector<uint8_t> single(shoeSize);
+        ShuffleKernel::ShuffleRounds(31u, 500u, batch.data(), shoes, d);
+        for (int k = 0; k < shoes; k++)
+        {
+            ShuffleKernel::ShuffleRound(31u, 500u + k, single.data(), d);
+            EXPECT_TRUE(equal(single.begin(), single.end(), batch.begin() + static_cast<size_t>(k) * shoeSize));
+        }
+    }
+    EXPECT_THROW(ShuffleKernel::ShuffleRounds(31u, 0u, nullptr, -1, 1), runtime_error);
+}
+
+/**
+ * @brief The pipeline's results depend on the seed only, not on the number of threads.
+ */
+TEST(PipelineTest, SameSeedSameResults)
+{
+    PipelineConfig config;
+    config.rounds = 3000;
+    config.seed = 99;
+    config.queueCapacity = 4;
+    config.thresholds = {16, 17};
+    PipelineReport single = Pipeline(config).Run();
+    config.shufflerThreads = 3;
+    config.playerThreads = 2;
+    PipelineReport threaded = Pipeline(config).Run();
+
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(single.stats.Busts(i), threaded.stats.Busts(i));
+        EXPECT_NEAR(single.stats.Wins(i).Mean(), threaded.stats.Wins(i).Mean(), 1e-9);
+        for (int score = 0; score <= SimulationStats::MaxScore; score++)
+            EXPECT_EQ(single.stats.ScoreCount(i, score), threaded.stats.ScoreCount(i, score));
+    }
+}
+
+/**
+ * @brief Records written in two sessions are read back from the mapping in order.
+ */
+TEST(HandHistoryTest, WriteAppendAndRead)
+{
+    const string path = testing::TempDir() + "blackjack_history_test.bjhh";
+    remove(path.c_str());
+
+    int thresholds[2] = {17, 14};
+    SeatResult results[2];
+    uint8_t shoe[CardsPerDeck];
+    for (uint64_t session = 0; session < 2; session++)
+    {
+        HandHistoryWriter writer(path, 3);
+        for (uint64_t round = session * 5; round < session * 5 + 5; round++)
+        {
+            ShuffleKernel::ShuffleRound(8, round, shoe, 1);
+            PlayRound(shoe, CardsPerDeck, thresholds, 2, results);
+            writer.WriteRound(round, shoe, thresholds, results, 2);
+        }
+        EXPECT_EQ(writer.Records(), 10u);
+    }
+
+    HandHistoryReader log(path);
+    ASSERT_EQ(log.Count(), 20u);
+    ShuffleKernel::ShuffleRound(8, 7, shoe, 1);
+    PlayRound(shoe, CardsPerDeck, thresholds, 2, results);
+    const HandRecord &record = log[15];
+    EXPECT_EQ(record.round, 7u);
+    EXPECT_EQ(record.seat, 1);
+    EXPECT_EQ(record.threshold, 14);
+    EXPECT_EQ(record.score, results[1].score);
+    EXPECT_EQ(record.cardCount, results[1].cards);
+    EXPECT_EQ(record.cards[0], shoe[results[1].first]);
+    EXPECT_EQ(record.outcome, results[1].isBusted ? HandBusted : (results[1].isWinner ? HandWon : HandLost));
+    remove(path.c_str());
+}
+
+/**
+ * @brief A file that is not a log is refused.
+ */
+TEST(HandHistoryTest, RejectsOtherFiles)
+{
+    const string path = testing::TempDir() + "blackjack_not_history.bjhh";
+    FILE *file = fopen(path.c_str(), "wb");
+    fputs("this is not a hand history log", file);
+    fclose(file);
+
+    EXPECT_THROW(HandHistoryReader log(path), std::runtime_error);
+    EXPECT_THROW(HandHistoryWriter writer(path), std::runtime_error);
+    remove(path.c_str());
+}
+
+/**
+ * @brief A log ending in a record torn by a crash is cut back to its last whole record before appending.
+ */
+TEST(HandHistoryTest, CutsTornRecordBeforeAppending)
+{
+    const string path = testing::TempDir() + "blackjack_torn_history.bjhh";
+    remove(path.c_str());
+
+    HandRecord record;
+    memset(&record, 0, sizeof(record));
+    {
+        HandHistoryWriter writer(path);
+        for (uint64_t round = 0; round < 3; round++)
+        {
+            record.round = round;
+            writer.Write(record);
+        }
+    }
+    FILE *file = fopen(path.c_str(), "ab");
+    fwrite(&record, sizeof(record) / 2, 1, file);
+    fclose(file);
+
+    {
+        HandHistoryWriter writer(path);
+        record.round = 3;
+        writer.Write(record);
+    }
+
+    HandHistoryReader log(path);
+    ASSERT_EQ(log.Count(), 4u);
+    for (uint64_t round = 0; round < 4; round++)
+        EXPECT_EQ(log[round].round, round);
+    remove(path.c_str());
+}
+
+/**
+ * @brief A table keeps its players between rounds and marks the winners without reordering them.
+ */
+TEST(TableTest, PlaysRoundsInSeatOrder)
+{
+    Table table(21);
+    table.Join("Ann", 17);
+    table.Join("Bob", 12);
+    table.Join("Cid", 19);
+
+    for (uint64_t round = 0; round < 50; round++)
+    {
+        EXPECT_EQ(table.Play(), round);
+        vector<Player> &players = table.Players();
+        ASSERT_EQ(players.size(), 3u);
+        EXPECT_EQ(players[1].GetName(), "Bob");
+
+        int best = -1;
+        for (Player &player : players)
+        {
+            EXPECT_GE(player.Score(), player.GetThreshold());
+            EXPECT_EQ(player.isBusted, player.Score() > 21);
+            if (!player.isBusted && player.Score() > best)
+                best = player.Score();
+        }
+        for (Player &player : players)
+            EXPECT_EQ(player.isWinner, player.Score() == best);
+    }
+}
+
+/**
+ * @brief A table round deals, scores and marks winners exactly as PlayBlackJack and SortPlayers do
+ *        on Deck::Seeded(seed, round).
+ */
+TEST(TableTest, MatchesPlayBlackJack)
+{
+    Table table(5);
+    table.Join("Ann", 17);
+    table.Join("Bob", 12);
+    table.Join("Cid", 19);
+    table.Join("Dee", 15);
+
+    for (uint64_t round = 0; round < 200; round++)
+    {
+        table.Play();
+        vector<Player> players = {Player("Ann", 17), Player("Bob", 12), Player("Cid", 19), Player("Dee", 15)};
+        Deck deck = Deck::Seeded(5, round);
+        PlayBlackJack(players, deck);
+        SortPlayers(players);
+
+        for (Player &expected : players)
+        {
+            for (Player &seat : table.Players())
+            {
+                if (seat.GetName() != expected.GetName())
+                    continue;
+                EXPECT_EQ(seat.ShowHand(), expected.ShowHand());
+                EXPECT_EQ(seat.isBusted, expected.isBusted);
+                EXPECT_EQ(seat.isWinner, expected.isWinner);
+            }
+        }
+    }
+}
+
+/**
+ * @brief The server answers one line per request over loopback TCP.
+ */
+TEST(GameServerTest, OpenPlayClose)
+{
+    ServerConfig config;
+    config.port = 0;
+    config.threads = 2;
+    GameServer server(config);
+    std::thread loop(&GameServer::Run, &server);
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(server.Port());
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_EQ(connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+
+    string replies;
+    auto request = [&](const string &line)
+    {
+        string text = line + "\n";
+        send(fd, text.data(), text.size(), 0);
+        string reply;
+        char c;
+        while (recv(fd, &c, 1, 0) == 1 && c != '\n')
+            reply += c;
+        return reply;
+    };
+
+    EXPECT_EQ(request("OPEN 3 17"), "OK 0");
+    EXPECT_EQ(request("JOIN 0 Dana 15"), "OK");
+    string result = request("PLAY 0");
+    EXPECT_EQ(result.compare(0, 9, "RESULT 0 "), 0);
+    EXPECT_NE(result.find("Dana"), string::npos);
+    EXPECT_EQ(request("CLOSE 0"), "OK");
+    EXPECT_EQ(request("PLAY 0").compare(0, 3, "ERR"), 0);
+    close(fd);
+
+    server.Stop();
+    loop.join();
+    EXPECT_EQ(server.Stats().tables, 1u);
+    EXPECT_EQ(server.Stats().rounds, 1u);
+}
+
+/**
+ * @brief A client that sends requests without reading the replies is paused by the server, so its
+ *        sends start to block, and every request is still answered once it reads.
+ */
+TEST(GameServerTest, PausesClientThatDoesNotRead)
+{
+    ServerConfig config;
+    config.unixPath = testing::TempDir() + "blackjack_backpressure.sock";
+    config.threads = 1;
+    GameServer server(config);
+    std::thread loop(&GameServer::Run, &server);
+
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, config.unixPath.c_str());
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+    const string open = "OPEN 6 17\n";
+    ASSERT_EQ(send(fd, open.data(), open.size(), 0), static_cast<ssize_t>(open.size()));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    // Without backpressure the server would read all of this and hold about 100 MB of replies
+    const string play = "PLAY 0\n";
+    string block;
+    for (int i = 0; i < 1024; i++)
+        block += play;
+    size_t sent = 0;
+    bool blocked = false;
+    while (!blocked && sent < (size_t(1) << 23))
+    {
+        ssize_t written = send(fd, block.data(), block.size(), MSG_NOSIGNAL);
+        if (written < 0)
+        {
+            // The socket stays full only if the server stopped reading
+            ASSERT_TRUE(errno == EAGAIN || errno == EWOULDBLOCK);
+            pollfd waiting = {fd, POLLOUT, 0};
+            blocked = poll(&waiting, 1, 500) == 0;
+        }
+        else
+            sent += written;
+    }
+    EXPECT_TRUE(blocked);
+
+    // Finish the last request, ask to quit, and read every reply while the server catches up
+    string pending = play.substr(sent % play.size() == 0 ? play.size() : sent % play.size()) + "QUIT\n";
+    size_t requests = (sent + play.size() - 1) / play.size();
+    size_t lines = 0;
+    char buffer[65536];
+    while (true)
+    {
+        pollfd waiting = {fd, static_cast<short>(POLLIN | (pending.empty() ? 0 : POLLOUT)), 0};
+        ASSERT_GT(poll(&waiting, 1, 10000), 0);
+        if (!pending.empty() && (waiting.revents & POLLOUT))
+        {
+            ssize_t written = send(fd, pending.data(), pending.size(), MSG_NOSIGNAL);
+            if (written > 0)
+                pending.erase(0, written);
+        }
+        ssize_t got = recv(fd, buffer, sizeof(buffer), 0);
+        if (got == 0)
+            break;
+        for (ssize_t i = 0; i < got; i++)
+            lines += buffer[i] == '\n';
+    }
+    EXPECT_EQ(lines, requests + 1);
+    close(fd);
+
+    server.Stop();
+    loop.join();
+    EXPECT_EQ(server.Stats().rounds, requests);
+}
+
+/**
+ * @brief The infinite deck never runs out and deals every card.
+ */
+TEST(InfiniteDeckTest, DealsWithReplacement)
+{
+    InfiniteDeck deck(5, 0);
+    int aces = 0;
+    for (int i = 0; i < 5200; i++)
+    {
+        Card card = deck.Deal();
+        EXPECT_FALSE(card.isFaceUp);
+        aces += card.GetValue() == 11;
+    }
+    EXPECT_GT(deck.CardsInDeck(), 52);
+    EXPECT_GT(aces, 300);
+    EXPECT_LT(aces, 500);
+}
+
+/**
+ * @brief Threshold 1 stops after two cards, so 21 comes only from an Ace and a ten, and Aces
+ *        score as Player scores them.
+ */
+TEST(ThresholdModelTest, TwoCardHands)
+{
+    vector<double> final = ThresholdModel::FinalScores(1);
+    double total = 0;
+    for (double p : final)
+        total += p;
+    EXPECT_NEAR(total, 1.0, 1e-12);
+    EXPECT_NEAR(final[21], 2 * (1 / 13.0) * (4 / 13.0), 1e-12);
+    // 2+ten, 3+9, 4+8, 5+7 and 6+6; A+A scores 2 as Player scores it
+    EXPECT_NEAR(final[12], (8 + 2 + 2 + 2 + 1) / 169.0, 1e-12);
+    EXPECT_NEAR(final[2], 1 / 169.0, 1e-12);
+    // Only A+A draws below 3, and A+A+A scores 3 where an Ace counted as 11 would make 13
+    EXPECT_NEAR(ThresholdModel::FinalScores(3)[3], 1 / (169.0 * 13), 1e-12);
+    EXPECT_DOUBLE_EQ(ThresholdModel::BustProbability(1), 0.0);
+}
+
+/**
+ * @brief The model agrees with PlayBlackJack played from an InfiniteDeck.
+ */
+TEST(ThresholdModelTest, MatchesSimulation)
+{
+    vector<int> thresholds = {17, 14, 19};
+    vector<double> wins = ThresholdModel::WinProbabilities(thresholds);
+    const int rounds = 100000;
+    vector<int> won(3, 0);
+    vector<int> busted(3, 0);
+    for (int round = 0; round < rounds; round++)
+    {
+        vector<Player> players;
+        for (int threshold : thresholds)
+            players.push_back(Player("Seat", threshold));
+        InfiniteDeck deck(77, round);
+        PlayBlackJack(players, deck);
+
+        int best = -1;
+        for (Player &player : players)
+        {
+            if (player.Score() <= 21 && player.Score() > best)
+                best = player.Score();
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            won[i] += players[i].Score() == best;
+            busted[i] += players[i].isBusted;
+        }
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_NEAR(won[i] / static_cast<double>(rounds), wins[i], 0.005);
+        EXPECT_NEAR(busted[i] / static_cast<double>(rounds), ThresholdModel::BustProbability(thresholds[i]), 0.005);
+    }
+}
+
+/**
+ * @brief Well known basic strategy plays and expected values come out of the solver.
+ */
+TEST(StrategySolverTest, KnownDecisions)
+{
+    StrategySolver solver(StrategyRules{});
+    EXPECT_THROW(solver.Best(16, false, 10, true), runtime_error);
+    solver.Solve();
+
+    EXPECT_EQ(solver.Best(16, false, 10, true), StrategyHit);
+    EXPECT_EQ(solver.Best(12, false, 4, true), StrategyStand);
+    EXPECT_EQ(solver.Best(11, false, 6, true), StrategyDouble);
+    EXPECT_EQ(solver.Best(11, false, 6, false), StrategyHit);
+    EXPECT_EQ(solver.Best(18, true, 10, true), StrategyHit);
+    EXPECT_EQ(solver.Best(17, false, 11, true), StrategyStand);
+    EXPECT_TRUE(solver.ShouldSplit(8, 10));
+    EXPECT_TRUE(solver.ShouldSplit(11, 6));
+    EXPECT_FALSE(solver.ShouldSplit(10, 6));
+    EXPECT_FALSE(solver.ShouldSplit(5, 6));
+
+    // 21 only loses to nothing and pushes a dealer 21
+    EXPECT_GT(solver.ExpectedValue(StrategyStand, 21, false, 6), 0.8);
+    EXPECT_LT(solver.ExpectedValue(StrategyStand, 16, false, 10), -0.5);
+}
+
+/**
+ * @brief Solving on one thread or several gives identical expected values.
+ */
+TEST(StrategySolverTest, ThreadCountDoesNotChangeResults)
+{
+    StrategySolver single(StrategyRules{});
+    StrategySolver many(StrategyRules{});
+    single.Solve(1);
+    many.Solve(4);
+    for (int upcard = 2; upcard <= 11; upcard++)
+    {
+        for (int total = 4; total <= 21; total++)
+        {
+            EXPECT_EQ(single.ExpectedValue(StrategyHit, total, false, upcard),
+                      many.ExpectedValue(StrategyHit, total, false, upcard));
+            EXPECT_EQ(single.ExpectedValue(StrategyDouble, total, false, upcard),
+                      many.ExpectedValue(StrategyDouble, total, false, upcard));
+        }
+    }
+}
+
+/**
+ * @brief The checked in BasicStrategy tables are the solver's decisions for their rules, and the
+ *        generated header does not change from one run to the next.
+ */
+TEST(StrategySolverTest, GeneratedTablesMatchSolver)
+{
+    static_assert(BasicStrategyAction(16, false, 10, false) == StrategyHit, "Tables are usable at compile time");
+
+    StrategyRules rules;
+    rules.decks = BasicStrategy::Decks;
+    rules.dealerHitsSoft17 = BasicStrategy::DealerHitsSoft17;
+    rules.doubleAfterSplit = BasicStrategy::DoubleAfterSplit;
+    StrategySolver solver(rules);
+    solver.Solve();
+
+    for (int upcard = 2; upcard <= 11; upcard++)
+    {
+        for (int soft = 0; soft < 2; soft++)
+        {
+            for (int total = soft ? 12 : 4; total <= 21; total++)
+            {
+                EXPECT_EQ(BasicStrategyAction(total, soft == 1, upcard, true), solver.Best(total, soft == 1, upcard, true));
+                EXPECT_EQ(BasicStrategyAction(total, soft == 1, upcard, false), solver.Best(total, soft == 1, upcard, false));
+            }
+        }
+        for (int pairCard = 2; pairCard <= 11; pairCard++)
+        {
+            int total = pairCard == 11 ? 12 : 2 * pairCard;
+            bool split = BasicStrategyAction(total, pairCard == 11, upcard, true, true) == StrategySplit;
+            EXPECT_EQ(split, solver.ShouldSplit(pairCard, upcard));
+        }
+    }
+
+    // Regenerating gives the same file, the banner carries no author or date
+    ostringstream header;
+    solver.WriteHeader(header);
+    EXPECT_EQ(header.str().find("@date"), string::npos);
+    EXPECT_EQ(header.str().find("@author"), string::npos);
+    EXPECT_NE(header.str().find("Generated by strategygen"), string::npos);
+}
+
+/**
+ * @brief Every system counts a dealt deck by its tags, and balanced systems end a full deck at zero.
+ */
+TEST(MultiCounterTest, FullDeckCounts)
+{
+    vector<CountingSystem> systems = StandardCountingSystems();
+    MultiCounter counter(systems, 1);
+    Deck deck = Deck::Seeded(12345u, 0u);
+    CountedDeck<Deck> counted(deck, counter);
+    vector<int> points;
+    while (counted.CardsInDeck() > 1)
+        points.push_back(counted.Deal().GetValue());
+
+    // Every system's count is the sum of its tags over the cards dealt
+    for (size_t s = 0; s < systems.size(); s++)
+    {
+        int expected = 0;
+        for (int value : points)
+            expected += systems[s].tags[value - 2];
+        EXPECT_DOUBLE_EQ(counter.RunningCount(s), static_cast<double>(expected) / systems[s].unit) << systems[s].name;
+    }
+    // Balanced systems end a deck at zero, KO at +4
+    counter.Shuffle();
+    for (uint8_t code = 0; code < CardsPerDeck; code++)
+        counter.AddPoints(CodeToPoints(code));
+    EXPECT_DOUBLE_EQ(counter.RunningCount(0), 0);
+    EXPECT_DOUBLE_EQ(counter.RunningCount(3), 4);
+    EXPECT_DOUBLE_EQ(counter.RunningCount(6), 0);
+
+    counter.Shuffle();
+    counter.AddPoints(5);
+    EXPECT_DOUBLE_EQ(counter.RunningCount(0), 1);
+    EXPECT_DOUBLE_EQ(counter.RunningCount(6), 1.5);
+}
+
+/**
+ * @brief Each system bets from its own true count and keeps its own wagers and results.
+ */
+TEST(MultiCounterTest, BetsFollowEachTrueCount)
+{
+    CountingSystem low = {"Low", {1, 1, 1, 1, 1, 0, 0, 0, -1, -1}, 1};
+    CountingSystem never = {"Never", {0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 1};
+    BetRamp ramp;
+    ramp.minUnits = 1;
+    ramp.maxUnits = 4;
+    MultiCounter counter({low, never}, 1, ramp);
+
+    counter.PlaceBets();
+    EXPECT_EQ(counter.Bet(0), 1);
+    for (int i = 0; i < 3; i++)
+        counter.AddPoints(5);
+    // Three points with 49 cards left is just over three per deck
+    counter.PlaceBets();
+    EXPECT_EQ(counter.Bet(0), 3);
+    EXPECT_EQ(counter.Bet(1), 1);
+    counter.SettleRound(1.0);
+
+    for (int i = 0; i < 10; i++)
+        counter.AddPoints(2);
+    counter.PlaceBets();
+    EXPECT_EQ(counter.Bet(0), 4);
+    counter.SettleRound(-1.0);
+
+    EXPECT_EQ(counter.Wagered(0), 7u);
+    EXPECT_EQ(counter.Wagered(1), 2u);
+    EXPECT_DOUBLE_EQ(counter.Results(0).Mean(), -0.5);
+    EXPECT_DOUBLE_EQ(counter.Results(1).Mean(), 0);
+    EXPECT_THROW(MultiCounter({}, 1), runtime_error);
+}
+
+/**
+ * @brief The hooks count every allocation, its bytes and every free.
+ */
+TEST(AllocationTest, HooksCountAllocations)
+{
+    AllocationScope scope;
+    vector<int> values(100);
+    EXPECT_EQ(scope.Count().allocations, 1u);
+    EXPECT_EQ(scope.Count().bytes, 100 * sizeof(int));
+    values = vector<int>();
+    EXPECT_EQ(scope.Count().frees, 1u);
+
+#if defined(__cpp_aligned_new)
+    // Over-aligned types go through the align_val_t overloads, which count too
+    struct alignas(64) Wide
+    {
+        char bytes[64];
+    };
+    Wide *wide = new Wide;
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % 64, 0u);
+    delete wide;
+    EXPECT_EQ(scope.Count().allocations, 2u);
+    EXPECT_EQ(scope.Count().frees, 2u);
+#endif
+}
+
+/**
+ * @brief Making and copying a Card allocates nothing, and its text is still right.
+ */
+TEST(AllocationTest, CardKeepsNoStrings)
+{
+    AllocationScope scope;
+    Card card(12, 3, true);
+    Card copy = card;
+    EXPECT_EQ(scope.Count().allocations, 0u);
+    EXPECT_EQ(copy.GetRank(), 12);
+    EXPECT_EQ(copy.GetSuit(), 3);
+    EXPECT_EQ(copy.GetValue(), 10);
+    EXPECT_EQ(copy.ToString(), "QUEEN HEARTS");
+}
+
+/**
+ * @brief Reset reshuffles a deck in place into the same order as a new deck with that seed and round.
+ */
+TEST(AllocationTest, DeckResetMatchesNewDeck)
+{
+    Deck deck = Deck::Seeded(99u, 0u);
+    for (int i = 0; i < 20; i++)
+        deck.Deal();
+    EXPECT_EQ(deck.CardsInDeck(), 32);
+
+    AllocationScope scope;
+    deck.Reset(99u, 7u);
+    EXPECT_EQ(scope.Count().allocations, 0u);
+    EXPECT_EQ(deck.CardsInDeck(), 52);
+
+    Deck fresh = Deck::Seeded(99u, 7u);
+    EXPECT_EQ(deck.ToString(), fresh.ToString());
+    for (int i = 0; i < 51; i++)
+    {
+        Card a = deck.Deal();
+        Card b = fresh.Deal();
+        EXPECT_EQ(a.GetRank(), b.GetRank());
+        EXPECT_EQ(a.GetSuit(), b.GetSuit());
+    }
+    EXPECT_THROW(deck.Deal(), runtime_error);
+}
+
+/**
+ * @brief Once players and deck exist, replaying rounds with them allocates nothing.
+ */
+TEST(AllocationTest, SteadyStateRoundAllocatesNothing)
+{
+    vector<Player> players;
+    for (int i = 0; i < 4; i++)
+        players.push_back(Player("Seat" + to_string(i + 1), 17));
+    Deck deck = Deck::Seeded(2024u, 0u);
+    PlayBlackJack(players, deck);
+    SortPlayers(players);
+
+    AllocationScope scope;
+    for (uint64_t round = 1; round <= 500; round++)
+    {
+        deck.Reset(2024u, round);
+        for (Player &player : players)
+        {
+            player.EmptyHand();
+            player.isBusted = false;
+            player.isWinner = false;
+        }
+        PlayBlackJack(players, deck);
+        SortPlayers(players);
+    }
+    EXPECT_EQ(scope.Count().allocations, 0u);
+    EXPECT_EQ(scope.Count().bytes, 0u);
+}
+
+/**
+ * @brief Shuffling into a buffer and playing it with PlayRound allocates nothing.
+ */
+TEST(AllocationTest, PlayRoundAllocatesNothing)
+{
+    int thresholds[4] = {17, 17, 15, 19};
+    SeatResult results[4];
+    uint8_t shoe[CardsPerDeck];
+
+    AllocationScope scope;
+    for (uint64_t round = 0; round < 500; round++)
+    {
+        ShuffleKernel::ShuffleRound(5, round, shoe, 1);
+        ASSERT_GE(PlayRound(shoe, CardsPerDeck, thresholds, 4, results), 0);
+    }
+    EXPECT_EQ(scope.Count().allocations, 0u);
+}
+
+/**
+ * @brief bj_play_rounds gives the same scores and winners as the kernels it wraps.
+ */
+TEST(CApiTest, BatchMatchesPlayRound)
+{
+    const int thresholds[3] = {14, 17, 19};
+    bj_engine *engine = nullptr;
+    ASSERT_EQ(bj_engine_create(77, 3, thresholds, 2, &engine), BJ_OK);
+    EXPECT_EQ(bj_engine_seats(engine), 3);
+
+    const int rounds = 300;
+    vector<int32_t> scores(rounds * 3);
+    vector<uint8_t> winners(rounds * 3);
+    vector<uint8_t> busted(rounds * 3);
+    AllocationScope scope;
+    ASSERT_EQ(bj_play_rounds(engine, 1000, rounds, scores.data(), winners.data(), busted.data()), BJ_OK);
+    EXPECT_EQ(scope.Count().allocations, 0u);
+
+    vector<uint8_t> shoe(2 * CardsPerDeck);
+    SeatResult results[3];
+    for (int r = 0; r < rounds; r++)
+    {
+        ShuffleKernel::ShuffleRound(77, 1000 + r, shoe.data(), 2);
+        ASSERT_GE(PlayRound(shoe.data(), static_cast<int>(shoe.size()), thresholds, 3, results), 0);
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(scores[r * 3 + i], results[i].score);
+            EXPECT_EQ(winners[r * 3 + i], results[i].isWinner ? 1 : 0);
+            EXPECT_EQ(busted[r * 3 + i], results[i].isBusted ? 1 : 0);
+        }
+    }
+
+    // Counting the same rounds gives the totals of the arrays
+    uint64_t wins[3] = {0, 0, 0};
+    ASSERT_EQ(bj_count_rounds(engine, 1000, rounds, wins, nullptr), BJ_OK);
+    for (int i = 0; i < 3; i++)
+    {
+        uint64_t expected = 0;
+        for (int r = 0; r < rounds; r++)
+            expected += winners[r * 3 + i];
+        EXPECT_EQ(wins[i], expected);
+    }
+    bj_engine_destroy(engine);
+}
+
+/**
+ * @brief The C API scores hands as the game does, checked against PlayBlackJack on rounds with
+ *        several Aces in one hand.
+ */
+TEST(CApiTest, MatchesPlayBlackJackWithAces)
+{
+    const uint64_t seed = 808;
+    const int seats = 4;
+    const int thresholds[seats] = {17, 19, 15, 21};
+    bj_engine *engine = nullptr;
+    ASSERT_EQ(bj_engine_create(seed, seats, thresholds, 1, &engine), BJ_OK);
+
+    uint8_t shoe[CardsPerDeck];
+    SeatResult results[seats];
+    int multiAceHands = 0;
+    for (uint64_t round = 0; round < 3000; round++)
+    {
+        int32_t scores[seats];
+        uint8_t winners[seats];
+        if (bj_play_rounds(engine, round, 1, scores, winners, nullptr) != BJ_OK)
+            continue;
+
+        ShuffleKernel::ShuffleRound(seed, round, shoe, 1);
+        ASSERT_GE(PlayRound(shoe, CardsPerDeck, thresholds, seats, results), 0);
+        for (int i = 0; i < seats; i++)
+        {
+            int aces = 0;
+            for (int c = 0; c < results[i].cards; c++)
+                aces += CodeToValue(shoe[results[i].first + c]) == 1;
+            multiAceHands += aces >= 2;
+        }
+
+        vector<Player> players;
+        for (int i = 0; i < seats; i++)
+            players.push_back(Player(to_string(i), thresholds[i]));
+        Deck deck = Deck::Seeded(seed, round);
+        PlayBlackJack(players, deck);
+        SortPlayers(players);
+        for (Player &player : players)
+        {
+            int i = stoi(player.GetName());
+            EXPECT_EQ(scores[i], player.Score());
+            EXPECT_EQ(winners[i], player.isWinner ? 1 : 0);
+        }
+    }
+    EXPECT_GT(multiAceHands, 100);
+    bj_engine_destroy(engine);
+}
+
+/**
+ * @brief Bad arguments and a shoe that runs out are reported as status codes.
+ */
+TEST(CApiTest, RejectsBadArguments)
+{
+    const int good[2] = {17, 17};
+    const int bad[2] = {17, 22};
+    bj_engine *engine = nullptr;
+    EXPECT_EQ(bj_engine_create(1, 2, bad, 1, &engine), BJ_ERROR_ARGUMENT);
+    EXPECT_EQ(engine, nullptr);
+    EXPECT_EQ(bj_engine_create(1, 0, good, 1, &engine), BJ_ERROR_ARGUMENT);
+    EXPECT_EQ(bj_engine_create(1, 2, good, 9, &engine), BJ_ERROR_ARGUMENT);
+    EXPECT_EQ(bj_engine_create(1, 2, good, 1, nullptr), BJ_ERROR_ARGUMENT);
+    EXPECT_EQ(bj_play_rounds(nullptr, 0, 1, nullptr, nullptr, nullptr), BJ_ERROR_ARGUMENT);
+    EXPECT_STREQ(bj_status_string(BJ_ERROR_OVER_DEALT), "shoe ran out of cards");
+
+    // Twenty seats drawing to 21 need more than one deck
+    vector<int> greedy(20, 21);
+    ASSERT_EQ(bj_engine_create(1, 20, greedy.data(), 1, &engine), BJ_OK);
+    uint64_t wins[20] = {};
+    EXPECT_EQ(bj_count_rounds(engine, 0, 1000, wins, nullptr), BJ_ERROR_OVER_DEALT);
+    bj_engine_destroy(engine);
+    bj_engine_destroy(nullptr);
+}
+
+/**
+ * @brief The arena aligns what it hands out, gives oversized requests their own block and frees every block on Release.
+ */
+TEST(PlayerPoolTest, ArenaAlignsAndReleases)
+{
+    MonotonicArena arena(256);
+    char *byte = arena.AllocateArray<char>(1);
+    double *number = arena.AllocateArray<double>(3);
+    EXPECT_NE(static_cast<void *>(byte), static_cast<void *>(number));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(number) % alignof(double), 0u);
+    EXPECT_EQ(arena.BytesReserved(), 256u);
+
+    // Too big for a block, so it gets its own
+    arena.Allocate(1000);
+    EXPECT_GT(arena.BytesReserved(), 1256u);
+
+    AllocationScope scope;
+    arena.Release();
+    EXPECT_EQ(scope.Count().frees, 2u);
+    EXPECT_EQ(arena.BytesReserved(), 0u);
+    EXPECT_EQ(arena.BytesUsed(), 0u);
+}
+
+/**
+ * @brief Equal names intern to one copy, also after the table has grown.
+ */
+TEST(PlayerPoolTest, InternerSharesEqualNames)
+{
+    MonotonicArena arena;
+    StringInterner names(arena);
+    NameView first = names.Intern("Alice");
+    string copy = "Alice";
+    EXPECT_EQ(names.Intern(copy).data(), first.data());
+    EXPECT_NE(names.Intern("Bob").data(), first.data());
+
+    // Enough names to grow the table several times
+    for (int i = 0; i < 1000; i++)
+        names.Intern("Player" + to_string(i));
+    EXPECT_EQ(names.Count(), 1002u);
+    EXPECT_EQ(names.Intern("Alice").data(), first.data());
+    EXPECT_EQ(names.Intern("Player500").str(), "Player500");
+    EXPECT_STREQ(names.Intern("Player999").data(), "Player999");
+}
+
+/**
+ * @brief The longest hand one deck can give a threshold player, four Aces, four 2s and three 3s,
+ *        fits the room a pooled hand starts with, so dealing it takes nothing from the arena.
+ */
+TEST(PlayerPoolTest, OneDeckHandFitsWithoutGrowing)
+{
+    const uint8_t codes[] = {0, 13, 26, 39, 1, 14, 27, 40, 2, 15, 28, 9, 22};
+    Deck deck = Deck::FromCodes(codes, sizeof(codes));
+    PlayerPool pool(256);
+    PooledPlayer &player = pool.Add("Longest", 21);
+    size_t reserved = pool.BytesReserved();
+
+    EXPECT_EQ(PlaySeat(player, deck), PooledPlayer::HandCards);
+    EXPECT_EQ(player.Score(), 21);
+    EXPECT_EQ(pool.BytesReserved(), reserved);
+
+    // Only a hand past one deck grows, from the arena
+    player.AddCard(deck.Deal());
+    EXPECT_GT(pool.BytesReserved(), reserved);
+    EXPECT_EQ(player.CountCards(), PooledPlayer::HandCards + 1);
+}
+
+/**
+ * @brief Pooled players deal, score and bust exactly as Player does from the same decks.
+ */
+TEST(PlayerPoolTest, PlaysLikePlayers)
+{
+    PlayerPool pool;
+    vector<PooledPlayer *> seats;
+    vector<Player> players;
+    for (int i = 0; i < 5; i++)
+    {
+        seats.push_back(&pool.Add("Seat" + to_string(i + 1), 13 + i));
+        players.push_back(Player("Seat" + to_string(i + 1), 13 + i));
+    }
+
+    for (uint64_t round = 0; round < 200; round++)
+    {
+        Deck a = Deck::Seeded(31u, round);
+        Deck b = Deck::Seeded(31u, round);
+        for (size_t i = 0; i < seats.size(); i++)
+        {
+            seats[i]->EmptyHand();
+            players[i].EmptyHand();
+            players[i].isBusted = false;
+        }
+        PlayBlackJack(seats, a);
+        PlayBlackJack(players, b);
+        for (size_t i = 0; i < seats.size(); i++)
+        {
+            EXPECT_EQ(seats[i]->Score(), players[i].Score());
+            EXPECT_EQ(seats[i]->CountCards(), players[i].CountCards());
+            EXPECT_EQ(seats[i]->isBusted, players[i].isBusted);
+            EXPECT_EQ(seats[i]->ShowHand(), players[i].ShowHand());
+        }
+    }
+    EXPECT_EQ(seats[2]->GetName().str(), players[2].GetName());
+}
+
+/**
+ * @brief A hundred thousand pooled players with long names cost only a handful of allocations.
+ */
+TEST(PlayerPoolTest, FewAllocationsForManyPlayers)
+{
+    const int entrants = 100000;
+    PlayerPool pool;
+    pool.Reserve(entrants);
+    string name = "Tournament entrant number ";
+
+    AllocationScope scope;
+    for (int i = 0; i < entrants; i++)
+    {
+        name.resize(26);
+        name += to_string(i % 50000);
+        pool.Add(name, 17);
+    }
+    AllocationCount made = scope.Count();
+
+    // Long names would cost each Player at least a name and a hand allocation
+    EXPECT_LT(made.allocations, 100u);
+    EXPECT_EQ(pool.Size(), static_cast<size_t>(entrants));
+    EXPECT_EQ(pool.Names(), 50000u);
+    EXPECT_EQ(pool[7].GetName().data(), pool[50007].GetName().data());
+
+    pool.Release();
+    EXPECT_EQ(pool.Size(), 0u);
+    EXPECT_EQ(pool.BytesReserved(), 0u);
+}
+
+#ifdef BLACKJACK_HAS_COROUTINES
+/**
+ * @brief Bots answer inline, so thousands of bot tables only suspend when they run out of rounds,
+ *        and each deals exactly what Table deals.
+ */
+TEST(TableSchedulerTest, BotTablesNeverSuspendMidRound)
+{
+    const size_t tables = 2000;
+    TableScheduler scheduler;
+    for (size_t i = 0; i < tables; i++)
+    {
+        size_t table = scheduler.AddTable(i);
+        scheduler.JoinBot(table, "Ann", 17);
+        scheduler.JoinBot(table, "Bob", 12);
+        scheduler.QueueRounds(table, 20);
+    }
+
+    EXPECT_EQ(scheduler.RunUntilIdle(), tables);
+    EXPECT_EQ(scheduler.Suspensions(), tables);
+
+    Table reference(1234);
+    reference.Join("Ann", 17);
+    reference.Join("Bob", 12);
+    for (int round = 0; round < 20; round++)
+        reference.Play();
+    EXPECT_EQ(scheduler.RoundsPlayed(1234), 20u);
+    for (int seat = 0; seat < 2; seat++)
+    {
+        EXPECT_EQ(scheduler.Players(1234)[seat].ShowHand(), reference.Players()[seat].ShowHand());
+        EXPECT_EQ(scheduler.Players(1234)[seat].isWinner, reference.Players()[seat].isWinner);
+    }
+}
+
+/**
+ * @brief A person waiting at one table does not hold up the others, and answering like a threshold
+ *        bot deals the same round.
+ */
+TEST(TableSchedulerTest, InteractiveSeatSuspendsOnlyItsTable)
+{
+    TableScheduler scheduler;
+    size_t person = scheduler.AddTable(7);
+    scheduler.JoinBot(person, "Ann", 15);
+    scheduler.JoinInteractive(person, "You");
+    size_t bots = scheduler.AddTable(8);
+    scheduler.JoinBot(bots, "Bob", 17);
+    scheduler.QueueRounds(bots, 3);
+
+    Table reference(7);
+    reference.Join("Ann", 15);
+    reference.Join("You", 16);
+
+    scheduler.RunUntilIdle();
+    EXPECT_EQ(scheduler.RoundsPlayed(bots), 3u);
+    EXPECT_EQ(scheduler.WaitingSeat(bots), -1);
+    EXPECT_THROW(scheduler.Decide(bots, true), runtime_error);
+
+    for (int round = 0; round < 3; round++)
+    {
+        scheduler.QueueRounds(person, 1);
+        scheduler.RunUntilIdle();
+        while (scheduler.WaitingSeat(person) == 1)
+        {
+            EXPECT_EQ(scheduler.RoundsPlayed(person), static_cast<uint64_t>(round));
+            scheduler.Decide(person, scheduler.Players(person)[1].Score() < 16);
+            scheduler.RunUntilIdle();
+        }
+        reference.Play();
+        EXPECT_EQ(scheduler.Players(person)[1].ShowHand(), reference.Players()[1].ShowHand());
+        EXPECT_EQ(scheduler.Players(person)[0].isWinner, reference.Players()[0].isWinner);
+    }
+    EXPECT_EQ(scheduler.RoundsPlayed(person), 3u);
+    EXPECT_EQ(scheduler.WaitingSeat(person), -1);
+}
+#endif
+
+/**
+ * @brief Stacked shoes deal seat, upcard, seat, hole card, then the draws in order.
+ */
+TEST(DealerTableTest, PaysBlackjacksDoublesAndSplits)
+{
+    const double bet = 10;
+
+    const uint8_t natural[] = {MakeCardCode(1, 1), MakeCardCode(9, 1), MakeCardCode(13, 1), MakeCardCode(7, 1)};
+    DealerTable blackjack(DealerRules(), natural, 4);
+    blackjack.Join(100);
+    blackjack.PlayRound(&bet);
+    EXPECT_DOUBLE_EQ(blackjack.Net(0), 15);
+    EXPECT_DOUBLE_EQ(blackjack.Bankroll(0), 115);
+
+    const uint8_t peeked[] = {MakeCardCode(10, 1), MakeCardCode(1, 1), MakeCardCode(9, 1), MakeCardCode(13, 1)};
+    DealerTable dealerBlackjack(DealerRules(), peeked, 4);
+    dealerBlackjack.Join(100);
+    dealerBlackjack.PlayRound(&bet);
+    EXPECT_DOUBLE_EQ(dealerBlackjack.Net(0), -10);
+
+    const uint8_t eleven[] = {MakeCardCode(6, 1), MakeCardCode(6, 2), MakeCardCode(5, 1), MakeCardCode(10, 1),
+                              MakeCardCode(10, 2), MakeCardCode(10, 3)};
+    DealerTable doubled(DealerRules(), eleven, 6);
+    doubled.Join(100);
+    doubled.PlayRound(&bet);
+    EXPECT_DOUBLE_EQ(doubled.Net(0), 20);
+
+    // The same hand without the money to double just hits
+    DealerTable shortStack(DealerRules(), eleven, 6);
+    shortStack.Join(bet);
+    shortStack.PlayRound(&bet);
+    EXPECT_DOUBLE_EQ(shortStack.Net(0), 10);
+
+    // Eights split against a ten: 18 loses to 19, 8 + 3 doubles to 21 and wins
+    const uint8_t eights[] = {MakeCardCode(8, 1), MakeCardCode(10, 1), MakeCardCode(8, 2), MakeCardCode(9, 1),
+                              MakeCardCode(10, 2), MakeCardCode(3, 1), MakeCardCode(10, 3)};
+    DealerTable split(DealerRules(), eights, 7);
+    split.Join(100);
+    split.PlayRound(&bet);
+    EXPECT_EQ(split.HandsPlayed(0), 2);
+    EXPECT_DOUBLE_EQ(split.Net(0), 10);
+    EXPECT_THROW(split.PlayRound(&bet), runtime_error);
+}
+
+/**
+ * @brief Basic strategy on a shuffled shoe loses a little, with the usual spread per hand.
+ */
+TEST(DealerTableTest, BasicStrategyEdge)
+{
+    BankrollSimulator simulator = BankrollSimulator::FromTable(DealerRules(), 3, 100000, 5u);
+    EXPECT_GT(simulator.MeanPerHand(), -0.03);
+    EXPECT_LT(simulator.MeanPerHand(), 0.02);
+    EXPECT_GT(sqrt(simulator.VariancePerHand()), 1.05);
+    EXPECT_LT(sqrt(simulator.VariancePerHand()), 1.25);
+
+    // A seat that cannot cover its bet sits out
+    DealerTable table(DealerRules(), 9u);
+    table.Join(5);
+    double bet = 10;
+    table.PlayRound(&bet);
+    EXPECT_EQ(table.HandsPlayed(0), 0);
+    EXPECT_DOUBLE_EQ(table.Bankroll(0), 5);
+}
+
+/**
+ * @brief An even coin flip per hand has an hourly variance of the hands per hour, and the
+ *        report does not depend on the number of threads.
+ */
+TEST(BankrollSimulatorTest, CoinFlipSessions)
+{
+    BankrollSimulator simulator({-1.0, 1.0}, {1.0, 1.0});
+    EXPECT_DOUBLE_EQ(simulator.MeanPerHand(), 0);
+    EXPECT_DOUBLE_EQ(simulator.VariancePerHand(), 1);
+
+    SessionConfig config;
+    config.paths = 20000;
+    config.hours = 2;
+    config.handsPerHour = 100;
+    config.bankroll = 1e6;
+    SessionReport one = simulator.Run(config, 1);
+    SessionReport many = simulator.Run(config, 3);
+
+    EXPECT_EQ(one.hands, 20000u * 200u);
+    EXPECT_EQ(one.hourly.Count(), 40000u);
+    EXPECT_NEAR(one.hourly.Mean(), 0, 0.5);
+    EXPECT_NEAR(one.hourly.Variance(), 100, 5);
+    EXPECT_EQ(one.ruin, 0);
+    EXPECT_EQ(one.final.Mean(), many.final.Mean());
+    EXPECT_EQ(one.drawdowns, many.drawdowns);
+    EXPECT_LE(one.DrawdownPercentile(0.5), one.DrawdownPercentile(0.99));
+}
+
+/**
+ * @brief Sessions that always lose stop playing when they go broke.
+ */
+TEST(BankrollSimulatorTest, RuinedSessionsStop)
+{
+    BankrollSimulator simulator({-1.0}, {1.0});
+    SessionConfig config;
+    config.paths = 3000;
+    config.hours = 1;
+    config.bankroll = 5;
+    SessionReport report = simulator.Run(config, 2);
+
+    EXPECT_EQ(report.ruin, 1);
+    EXPECT_EQ(report.hands, 3000u * 5u);
+    EXPECT_EQ(report.DrawdownPercentile(0.01), 5);
+    EXPECT_EQ(report.final.Mean(), 0);
+}
+
+/**
+ * @brief A session stops once it cannot cover a hand's worst loss, so losses of several units,
+ *        as after a double or a split, never take a bankroll below zero.
+ */
+TEST(BankrollSimulatorTest, MultiUnitLossesStopAtTheFloor)
+{
+    SessionConfig config;
+    config.paths = 3000;
+    config.hours = 1;
+    config.bankroll = 10;
+    SessionReport always = BankrollSimulator({-3.0}, {1.0}).Run(config, 2);
+    EXPECT_EQ(always.ruin, 1);
+    EXPECT_EQ(always.hands, 3000u * 3u);
+    EXPECT_EQ(always.final.Mean(), 1);
+
+    // From 5 one hand leaves 1 or 3, neither covers a loss of 4, and an outcome that never
+    // happens does not raise the floor
+    config.bankroll = 5;
+    BankrollSimulator simulator({-4.0, -2.0, -8.0}, {1.0, 1.0, 0.0});
+    EXPECT_EQ(simulator.Floor(), 4);
+    SessionReport mixed = simulator.Run(config, 2);
+    EXPECT_EQ(mixed.ruin, 1);
+    EXPECT_EQ(mixed.hands, 3000u);
+    EXPECT_NEAR(mixed.final.Mean(), 2, 0.1);
+    EXPECT_NEAR(mixed.final.Variance(), 1, 0.05);
+    EXPECT_EQ(RuinCalculator(simulator.Outcomes(), simulator.Probabilities()).Session(5, 1, simulator.Floor()).Ruin(), 1);
+}
+
+/**
+ * @brief FFT convolution matches the sum of two fair coins.
+ */
+TEST(RuinCalculatorTest, Convolve)
+{
+    vector<double> coin = {0.5, 0.5};
+    vector<double> sum = RuinCalculator::Convolve(coin, coin);
+    ASSERT_EQ(sum.size(), 3u);
+    EXPECT_NEAR(sum[0], 0.25, 1e-15);
+    EXPECT_NEAR(sum[1], 0.5, 1e-15);
+    EXPECT_NEAR(sum[2], 0.25, 1e-15);
+}
+
+/**
+ * @brief The blocked FFT result equals stepping every hand directly, which is what the
+ *        calculator replaces.
+ */
+TEST(RuinCalculatorTest, MatchesHandByHandSteps)
+{
+    vector<double> outcomes = {-2, -1, 0, 1, 1.5, 2};
+    vector<double> weights = {0.05, 0.42, 0.08, 0.36, 0.045, 0.045};
+    RuinCalculator calculator(outcomes, weights);
+    EXPECT_EQ(calculator.Step(), 0.5);
+
+    const int hands = 200;
+    SessionDistribution session = calculator.Session(10, hands);
+
+    // Bankrolls in half units, ruined below 1 unit
+    map<int, double> live = {{20, 1.0}};
+    double ruin = 0;
+    for (int hand = 0; hand < hands; hand++)
+    {
+        map<int, double> next;
+        for (const pair<const int, double> &state : live)
+        {
+            for (size_t i = 0; i < outcomes.size(); i++)
+            {
+                int to = state.first + static_cast<int>(outcomes[i] * 2);
+                if (to < 2)
+                    ruin += state.second * weights[i];
+                else
+                    next[to] += state.second * weights[i];
+            }
+        }
+        live.swap(next);
+        ASSERT_NEAR(session.ruinByHand[hand], ruin, 1e-12);
+    }
+
+    double mean = 0;
+    for (const pair<const int, double> &state : live)
+        mean += state.second * state.first / 2.0;
+    EXPECT_NEAR(session.SurvivorMean(), mean / (1 - ruin), 1e-9);
+    EXPECT_NEAR(session.Below(10), ruin + [&]()
+                {
+                    double below = 0;
+                    for (const pair<const int, double> &state : live)
+                        below += state.first < 20 ? state.second : 0;
+                    return below;
+                }(), 1e-12);
+}
+
+/**
+ * @brief A long session of a favourable coin approaches the gambler's ruin formula (q / p)^b.
+ */
+TEST(RuinCalculatorTest, GamblersRuin)
+{
+    RuinCalculator calculator({-1.0, 1.0}, {0.4, 0.6});
+    SessionDistribution session = calculator.Session(5, 5000);
+    EXPECT_NEAR(session.Ruin(), pow(0.4 / 0.6, 5), 1e-9);
+    EXPECT_EQ(session.ruinByHand[3], 0);
+    EXPECT_NEAR(session.ruinByHand[4], pow(0.4, 5), 1e-15);
+
+    // Without losses the barrier is never reached
+    SessionDistribution winning = RuinCalculator({0.0, 1.0}, {0.5, 0.5}).Session(1, 10);
+    EXPECT_EQ(winning.Ruin(), 0);
+    EXPECT_NEAR(winning.SurvivorMean(), 6, 1e-12);
+    EXPECT_THROW(RuinCalculator({0.3333}, {1.0}), runtime_error);
+}
+
+/**
+ * @brief One sweep agrees with PlayRound for every threshold and start, running out of cards included.
+ */
+TEST(ThresholdSweepTest, MatchesPlayRound)
+{
+    uint8_t shoe[CardsPerDeck];
+    for (uint64_t round = 0; round < 300; round++)
+    {
+        ShuffleKernel::ShuffleRound(17u, round, shoe, 1);
+        for (int first = 0; first < CardsPerDeck; first += 7)
+        {
+            ThresholdSweep sweep;
+            SweepThresholds(shoe, CardsPerDeck, first, sweep);
+            for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+            {
+                SeatResult result;
+                int dealt = PlayRound(shoe + first, CardsPerDeck - first, &threshold, 1, &result);
+                uint32_t bit = 1u << threshold;
+                ASSERT_EQ((sweep.overDealt & bit) != 0, dealt < 0);
+                if (dealt < 0)
+                    continue;
+                EXPECT_EQ(sweep.score[threshold], result.score);
+                EXPECT_EQ(sweep.cards[threshold], result.cards);
+                EXPECT_EQ((sweep.busted & bit) != 0, result.isBusted);
+            }
+        }
+    }
+}
+
+/**
+ * @brief One sweep agrees with a Player dealt by PlayBlackJack at every threshold, on shoes that
+ *        start with two or more Aces in the first few cards.
+ */
+TEST(ThresholdSweepTest, MatchesPlayBlackJackWithAces)
+{
+    const uint64_t seed = 23;
+    uint8_t shoe[CardsPerDeck];
+    int aceShoes = 0;
+    for (uint64_t round = 0; round < 3000; round++)
+    {
+        ShuffleKernel::ShuffleRound(seed, round, shoe, 1);
+        int aces = 0;
+        for (int c = 0; c < 6; c++)
+            aces += CodeToValue(shoe[c]) == 1;
+        if (aces < 2)
+            continue;
+        aceShoes++;
+
+        ThresholdSweep sweep;
+        SweepThresholds(shoe, CardsPerDeck, 0, sweep);
+        ASSERT_EQ(sweep.overDealt, 0u);
+        for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+        {
+            vector<Player> players = {Player("Seat", threshold)};
+            Deck deck = Deck::Seeded(seed, round);
+            PlayBlackJack(players, deck);
+            EXPECT_EQ(sweep.score[threshold], players[0].Score()) << "round " << round << " threshold " << threshold;
+            EXPECT_EQ(sweep.cards[threshold], players[0].CountCards());
+            EXPECT_EQ((sweep.busted & (1u << threshold)) != 0, players[0].isBusted);
+        }
+    }
+    EXPECT_GT(aceShoes, 100);
+}
+
+/**
+ * @brief The study counts the same as playing each threshold separately, from a few walks per shoe.
+ */
+TEST(ThresholdSweepTest, StudyMatchesSeparateRuns)
+{
+    const int seats = 13;
+    const int rounds = 1000;
+    ThresholdStudy study(seats);
+    ThresholdStudy separate(seats);
+    vector<uint64_t> overDealt(MaxThreshold, 0);
+    vector<SeatResult> results(seats);
+    uint8_t shoe[CardsPerDeck];
+    for (int round = 0; round < rounds; round++)
+    {
+        ShuffleKernel::ShuffleRound(23u, round, shoe, 1);
+        study.AddShoe(shoe, CardsPerDeck);
+        for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+        {
+            vector<int> thresholds(seats, threshold);
+            if (PlayRound(shoe, CardsPerDeck, thresholds.data(), seats, results.data()) < 0)
+                overDealt[threshold - 1]++;
+            else
+                separate.AddRound(threshold, results.data());
+        }
+    }
+
+    for (int threshold = 1; threshold <= MaxThreshold; threshold++)
+    {
+        EXPECT_EQ(study.OverDealt(threshold), overDealt[threshold - 1]);
+        ASSERT_EQ(study.Rounds(threshold), separate.Rounds(threshold));
+        for (int seat = 0; seat < seats; seat++)
+        {
+            EXPECT_EQ(study.Busts(threshold, seat), separate.Busts(threshold, seat));
+            EXPECT_EQ(study.Wins(threshold, seat), separate.Wins(threshold, seat));
+            for (int score = 0; score <= ThresholdStudy::MaxScore; score++)
+                EXPECT_EQ(study.ScoreCount(threshold, seat, score), separate.ScoreCount(threshold, seat, score));
+        }
+    }
+    EXPECT_GT(study.OverDealt(21), 0u);
+    EXPECT_EQ(study.Shoes(), static_cast<uint64_t>(rounds));
+    EXPECT_LT(study.Sweeps(), static_cast<uint64_t>(rounds) * MaxThreshold * seats / 4);
+}
+
+/**
+ * @brief PlayBlackJack records every seat's threshold, cut point and score, and the deck order.
+ */
+TEST(WhatIfTest, RecordsRound)
+{
+    vector<Player> players;
+    for (int i = 0; i < 4; i++)
+        players.push_back(Player("P" + to_string(i), 12 + i * 2));
+    Deck deck = Deck::Seeded(7u, 3u);
+    RoundRecord record(deck);
+    PlayBlackJack(players, deck, &record);
+
+    ASSERT_EQ(record.order.size(), static_cast<size_t>(CardsPerDeck));
+    ASSERT_EQ(record.seats.size(), 4u);
+    int first = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(record.seats[i].threshold, 12 + i * 2);
+        EXPECT_EQ(record.seats[i].first, first);
+        EXPECT_EQ(record.seats[i].cards, players[i].CountCards());
+        EXPECT_EQ(record.seats[i].score, players[i].Score());
+        first += record.seats[i].cards;
+    }
+    EXPECT_EQ(deck.CardsInDeck(), CardsPerDeck - first);
+}
+
+/**
+ * @brief Changing one threshold gives the same round as replaying it from a new deck, and only
+ *        re-deals seats until one starts where it did before.
+ */
+TEST(WhatIfTest, MatchesReplay)
+{
+    const int seats = 40;
+    const int decks = 4;
+    vector<uint8_t> shoe(CardsPerDeck * decks);
+    vector<int> thresholds(seats, 17);
+    for (uint64_t round = 0; round < 20; round++)
+    {
+        ShuffleKernel::ShuffleRound(11u, round, shoe.data(), decks);
+        vector<Player> players;
+        for (int i = 0; i < seats; i++)
+            players.push_back(Player("P", thresholds[i]));
+        Deck deck = Deck::FromCodes(shoe.data(), static_cast<int>(shoe.size()));
+        RoundRecord record(deck);
+        PlayBlackJack(players, deck, &record);
+        WhatIfRound whatIf(record);
+
+        for (int change = 0; change < 10; change++)
+        {
+            int seat = static_cast<int>((round * 7 + change * 13) % seats);
+            int threshold = 1 + static_cast<int>((round + change * 5) % 21);
+            int changed = whatIf.SetThreshold(seat, threshold);
+            if (changed < 0)
+                continue;
+            EXPECT_LE(changed, seats - seat);
+
+            vector<Player> replayed;
+            for (int i = 0; i < seats; i++)
+                replayed.push_back(Player("P", whatIf.Seat(i).threshold));
+            Deck replayDeck = Deck::FromCodes(shoe.data(), static_cast<int>(shoe.size()));
+            PlayBlackJack(replayed, replayDeck);
+            int best = 0;
+            for (int i = 0; i < seats; i++)
+            {
+                ASSERT_EQ(whatIf.Seat(i).score, replayed[i].Score());
+                ASSERT_EQ(whatIf.Seat(i).cards, replayed[i].CountCards());
+                if (replayed[i].Score() <= 21)
+                    best = max(best, replayed[i].Score());
+            }
+            EXPECT_EQ(whatIf.BestScore(), best);
+            for (int i = 0; i < seats; i++)
+                EXPECT_EQ(whatIf.IsWinner(i), replayed[i].Score() == best && best > 0);
+        }
+    }
+}
+
+/**
+ * @brief A change that runs the deck out is refused and leaves the round as it was.
+ */
+TEST(WhatIfTest, OverDealtLeavesRoundUnchanged)
+{
+    vector<Player> players;
+    for (int i = 0; i < 16; i++)
+        players.push_back(Player("P", 1));
+    Deck deck = Deck::Seeded(5u, 0u);
+    RoundRecord record(deck);
+    PlayBlackJack(players, deck, &record);
+    WhatIfRound whatIf(record);
+
+    // Sixteen seats at 21 need more than one deck, so raising them one by one runs it out
+    int refused = -1;
+    for (int i = 0; i < 16 && refused < 0; i++)
+    {
+        vector<int> scores;
+        for (int j = 0; j < 16; j++)
+            scores.push_back(whatIf.Seat(j).score);
+        int best = whatIf.BestScore();
+        if (whatIf.SetThreshold(i, 21) < 0)
+        {
+            refused = i;
+            EXPECT_EQ(whatIf.Seat(i).threshold, 1);
+            EXPECT_EQ(whatIf.BestScore(), best);
+            for (int j = 0; j < 16; j++)
+                EXPECT_EQ(whatIf.Seat(j).score, scores[j]);
+        }
+    }
+    EXPECT_GE(refused, 0);
+    EXPECT_EQ(whatIf.SetThreshold(0, whatIf.Seat(0).threshold), 0);
+    EXPECT_THROW(whatIf.SetThreshold(0, 22), runtime_error);
+}
+
+/**
+ * @brief EmptyHand clears the results of the last round as well as the hand.
+ */
+TEST(TournamentTest, EmptyHandResetsRound)
+{
+    Player player("Reused", 21);
+    Deck deck = Deck::Seeded(3u, 1u);
+    while (player.Score() <= 21)
+        player.AddCard(deck.Deal());
+    player.isBusted = true;
+    player.isWinner = true;
+    player.EmptyHand();
+    EXPECT_EQ(player.CountCards(), 0);
+    EXPECT_EQ(player.Score(), 0);
+    EXPECT_FALSE(player.isBusted);
+    EXPECT_FALSE(player.isWinner);
+}
+
+/**
+ * @brief Every round seats everyone left at balanced tables and keeps only winners, down to a
+ *        final table, and a champion won every round.
+ */
+TEST(TournamentTest, EliminatesDownToFinalTable)
+{
+    TournamentConfig config;
+    config.entrants = 5000;
+    config.seatsPerTable = 5;
+    config.thresholds = {14, 16, 18};
+    config.seed = 21;
+    Tournament tournament(config);
+    EXPECT_EQ(tournament.Entrants(), 5000u);
+    EXPECT_EQ(tournament.Entrant(4).GetThreshold(), 16);
+    tournament.Run();
+
+    ASSERT_TRUE(tournament.Finished());
+    EXPECT_FALSE(tournament.PlayRound());
+    const vector<TournamentRound> &rounds = tournament.Rounds();
+    uint64_t players = config.entrants;
+    for (const TournamentRound &round : rounds)
+    {
+        EXPECT_EQ(round.players, players);
+        EXPECT_EQ(round.tables, (players + 4) / 5);
+        EXPECT_GE(round.survivors, round.tables);
+        EXPECT_LE(round.survivors, round.players);
+        players = round.survivors;
+    }
+    EXPECT_EQ(rounds.back().tables, 1u);
+    ASSERT_EQ(tournament.Survivors().size(), players);
+    for (uint32_t champion : tournament.Survivors())
+    {
+        EXPECT_EQ(tournament.RoundsWon(champion), rounds.size());
+        EXPECT_TRUE(tournament.Entrant(champion).isWinner);
+    }
+    EXPECT_THROW(Tournament(TournamentConfig{10, 9}), runtime_error);
+    TournamentConfig badThreshold;
+    badThreshold.thresholds = {17, 22};
+    EXPECT_THROW(Tournament{badThreshold}, runtime_error);
+
+    // The pool grows with the entrants instead of always taking a 16 MB block
+    EXPECT_LT(Tournament(TournamentConfig{10}).BytesReserved(), 1u << 20);
+}
+
+/**
+ * @brief The bracket depends on the seed only, not on the number of threads.
+ */
+TEST(TournamentTest, SameOnAnyThreads)
+{
+    TournamentConfig config;
+    config.entrants = 20000;
+    config.seed = 5;
+    config.threads = 1;
+    Tournament single(config);
+    single.Run();
+    config.threads = 4;
+    Tournament parallel(config);
+    parallel.Run();
+
+    EXPECT_EQ(single.Survivors(), parallel.Survivors());
+    ASSERT_EQ(single.Rounds().size(), parallel.Rounds().size());
+    for (size_t i = 0; i < single.Rounds().size(); i++)
+        EXPECT_EQ(single.Rounds()[i].survivors, parallel.Rounds()[i].survivors);
+    for (size_t i = 0; i < config.entrants; i += 997)
+        EXPECT_EQ(single.RoundsWon(i), parallel.RoundsWon(i));
+}